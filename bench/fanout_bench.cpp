@@ -0,0 +1,99 @@
+//先是自己的头文件
+#include "dense_registry.hpp"
+
+//然后是c++库函数
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <set>
+#include <vector>
+
+//最后是c库函数
+#include <cstdint>
+#include <cstdio>
+
+using namespace messageDeal;
+
+//room广播的时候遍历一遍房间里的人，以前是std::set<chat_session_ptr>，现在是dense_registry
+//session用一个400多字节的结构代替(和chat_session差不多大)，建的时候和别的大小不一的内存穿插着分配，
+//像跑了一阵子的服务器那样，session在堆上是散开的
+//fanout是每个接收者遍历一次的时间，join+leave是进出一次的时间(先乱序进，再一半的人出去又进来)
+
+namespace {
+    struct session {
+        std::uint64_t delivered = 0;
+        char pad[400];
+    };
+    typedef std::shared_ptr<session> session_ptr;
+
+    double now(){
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    //每档都遍历差不多这么多个接收者
+    const std::size_t total = 20000000;
+}
+
+int main(){
+    std::mt19937 rng(1);
+    std::printf("%8s %18s %18s %22s %22s\n", "sessions", "set fanout ns", "dense fanout ns",
+            "set join+leave ns", "dense join+leave ns");
+    for (std::size_t n: {1000, 10000, 100000}) {
+        std::vector<session_ptr> all;
+        std::vector<std::unique_ptr<char[]>> noise;
+        for (std::size_t i = 0; i < n; ++i) {
+            all.push_back(std::make_shared<session>());
+            noise.emplace_back(new char[rng() % 512 + 16]);
+        }
+        std::vector<std::size_t> order(n);
+        for (std::size_t i = 0; i < n; ++i)
+            order[i] = i;
+        std::shuffle(order.begin(), order.end(), rng);
+
+        std::set<session_ptr> set;
+        double t0 = now();
+        for (std::size_t i: order)
+            set.insert(all[i]);
+        for (std::size_t k = 0; k < n / 2; ++k) {
+            set.erase(all[order[k]]);
+            set.insert(all[order[k]]);
+        }
+        double set_churn = now() - t0;
+
+        dense_registry<session_ptr> dense;
+        std::vector<dense_registry<session_ptr>::handle> handles(n);
+        t0 = now();
+        for (std::size_t i: order)
+            handles[i] = dense.insert(all[i]);
+        for (std::size_t k = 0; k < n / 2; ++k) {
+            dense.erase(handles[order[k]]);
+            handles[order[k]] = dense.insert(all[order[k]]);
+        }
+        double dense_churn = now() - t0;
+
+        std::size_t rounds = total / n;
+        t0 = now();
+        for (std::size_t r = 0; r < rounds; ++r)
+            for (const session_ptr& s: set)
+                s->delivered += 1;
+        double set_fanout = now() - t0;
+        t0 = now();
+        for (std::size_t r = 0; r < rounds; ++r)
+            for (const session_ptr& s: dense)
+                s->delivered += 1;
+        double dense_fanout = now() - t0;
+
+        std::uint64_t delivered = 0;
+        for (const session_ptr& s: all)
+            delivered += s->delivered;
+        if (delivered != 2 * rounds * n)
+            std::fprintf(stderr, "fanout missed someone\n");
+        double recipients = static_cast<double>(rounds * n);
+        double ops = static_cast<double>(n * 2);  //n次进，n/2次出再进
+        std::printf("%8zu %18.2f %18.2f %22.0f %22.0f\n", n,
+                set_fanout * 1e9 / recipients, dense_fanout * 1e9 / recipients,
+                set_churn * 1e9 / ops, dense_churn * 1e9 / ops);
+    }
+    return 0;
+}
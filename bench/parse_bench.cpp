@@ -0,0 +1,65 @@
+//先是自己的头文件
+#include "chat_message.hpp"
+#include "Protocal.pb.h"
+
+//然后是c++库函数
+#include <chrono>
+#include <iostream>
+#include <string>
+
+//最后是c库函数
+#include <cstdio>
+
+using namespace chat::information;
+using namespace messageDeal;
+
+//收到一帧以后解析body的代价，按聊天内容的长度分几档
+//copy是以前的做法：先拿body拼一个临时string再ParseFromString(那时候还是按'\0'找结尾，这里按长度拷，只会更快)
+//in place是现在的chat_message::parseBody，直接在帧的内存上ParseFromArray
+
+namespace {
+    double seconds(std::chrono::steady_clock::time_point begin){
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    }
+
+    //每档都解析差不多total字节，小消息多跑几轮
+    const std::size_t total = 512 * 1024 * 1024;
+}
+
+int main(){
+    GOOGLE_PROTOBUF_VERIFY_VERSION;
+    std::printf("%8s %12s %12s %14s %14s\n", "bytes", "copy ns", "in place ns", "copy MB/s", "in place MB/s");
+    for (std::size_t size: {16, 64, 256, 1024, 1400}) {
+        PChat chat;
+        chat.set_information(std::string(size, 'x'));
+        chat_message frame;
+        frame.setMessage(MT_CHAT_INFO, chat);
+        std::size_t rounds = total / frame.body_length();
+
+        //每轮用同一个对象，和服务器上每条消息都在arena上新建比，只差分配，两种做法都一样
+        PChat parsed;
+        std::size_t checksum = 0;
+        auto begin = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < rounds; ++i) {
+            std::string body(frame.body(), frame.body_length());
+            parsed.ParseFromString(body);
+            checksum += parsed.information().size();
+        }
+        double copy = seconds(begin);
+
+        begin = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < rounds; ++i) {
+            frame.parseBody(parsed);
+            checksum += parsed.information().size();
+        }
+        double in_place = seconds(begin);
+
+        if (checksum != 2 * rounds * size)
+            std::cerr << "parse failed" << std::endl;
+        double bytes = static_cast<double>(rounds * frame.body_length()) / (1024 * 1024);
+        std::printf("%8zu %12.1f %12.1f %14.0f %14.0f\n", frame.body_length(),
+                copy * 1e9 / rounds, in_place * 1e9 / rounds, bytes / copy, bytes / in_place);
+    }
+    google::protobuf::ShutdownProtobufLibrary();
+    return 0;
+}
@@ -1,13 +1,17 @@
 #ifndef CHAT_MESSAGE_HPP
 #define CHAT_MESSAGE_HPP
 #include "Protocal.pb.h"
+#include "message_buffer.hpp"
+#include "message_codec.hpp"
 
 #include <iostream>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <vector>
 
 #include <cassert>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -36,8 +40,71 @@ namespace messageDeal {
         MT_BIND_NAME = 1,
         MT_CHAT_INFO = 2,
         MT_ROOM_INFO = 3,
+        MT_HELLO = 4,  //连上以后协商用哪些功能，body是PHello
+        MT_CHUNK = 5,  //大消息的一个分片，body是PChunk
+        MT_DEFLATED = 6,  //压缩过的一帧或者几帧，见deflate_codec.hpp
+        MT_BATCH = 7,     //好几条PRoomInformation打成的一帧，body是PRoomBatch
+        MT_ROOM_INFO_FLAT = 8,  //和MT_ROOM_INFO一样，body是flat_codec的平铺格式
+        MT_JOIN_ROOM = 9,   //换到另一个房间，body是PJoinRoom
+        MT_LEAVE_ROOM = 10, //回到大厅，body是PLeaveRoom
+        MT_DIRECT = 11,     //私聊，body是PDirectMessage
+        MT_SERVER_ERROR = 12,  //服务器告诉客户端出错了，body是PServerErrorMessage
+        MT_PRESENCE_QUERY = 13,  //查询/订阅房间里有谁，body是PPresenceQuery
+        MT_PRESENCE = 14,        //房间的名单或者名单的变化，body是PPresence
+        MT_HISTORY_QUERY = 15,   //往前翻历史消息，body是PHistoryQuery
+        MT_HISTORY = 16,         //翻到的历史消息，body是PHistory，后面紧跟着那几条消息
     };
 
+    //PHello里features的各个位
+    enum Feature {
+        FEATURE_COMPACT_HEADER = 1,  //紧凑帧头
+        FEATURE_DEFLATE = 2,         //服务器发下来的帧可以压缩
+        FEATURE_BATCH = 4,           //积压的消息可以打成MT_BATCH发
+        FEATURE_FLAT = 8,            //聊天消息可以用MT_ROOM_INFO_FLAT发
+    };
+
+    //协商以后可以用的紧凑帧头：body长度用varint，后面跟1字节的type
+    //短的聊天消息帧头只要3个字节，Header要8个；varint是按字节定义的，也不用管大小端
+    //没有发过MT_HELLO的老客户端还是用上面的Header
+    enum { compact_header_max_length = 6 };  //varint最多5个字节，再加1字节type
+
+    struct CompactHeader {
+        unsigned char bytes[compact_header_max_length];
+        std::size_t length;
+    };
+
+    constexpr CompactHeader encode_compact_header(std::uint32_t bodySize, std::uint8_t type){
+        CompactHeader header{{}, 0};
+        while (bodySize >= 0x80) {
+            header.bytes[header.length++] = static_cast<unsigned char>(bodySize | 0x80);
+            bodySize >>= 7;
+        }
+        header.bytes[header.length++] = static_cast<unsigned char>(bodySize);
+        header.bytes[header.length++] = type;
+        return header;
+    }
+
+    //返回帧头占几个字节；数据还不够一个帧头返回0，varint超过5个字节返回-1
+    constexpr int decode_compact_header(const unsigned char* data, std::size_t size, Header& header){
+        std::uint32_t bodySize = 0;
+        for (std::size_t i = 0; i < compact_header_max_length - 1; ++i) {
+            if (i >= size)
+                return 0;
+            bodySize |= static_cast<std::uint32_t>(data[i] & 0x7f) << (7 * i);
+            if (!(data[i] & 0x80)) {
+                if (i + 1 >= size)
+                    return 0;
+                header.bodySize = static_cast<std::int32_t>(bodySize);
+                header.type = data[i + 1];
+                return static_cast<int>(i + 2);
+            }
+        }
+        return -1;
+    }
+
+    static_assert(encode_compact_header(5, MT_CHAT_INFO).length == 2, "one byte varint");
+    static_assert(encode_compact_header(1460, MT_ROOM_INFO).length == 3, "max body fits in two bytes");
+
     //这里相当于把聊天对话的信息封装了一下
     class chat_message
     {
@@ -46,6 +113,8 @@ namespace messageDeal {
             //因为头部是定长的，所以好处理，所以一开始一般先处理头部
             enum { header_length = sizeof(Header) };
             enum { body_max_length = 1460 };
+            //PChunk里每片最多带这么多数据，服务器加上name和time转发的时候还要能装进一帧
+            enum { chunk_max_data = 1024 };
 
             chat_message() {m_data.resize(header_length);}
 
@@ -57,17 +126,17 @@ namespace messageDeal {
                 m_data.resize(size);
             }
 
-            //有这个和const版本就够了，反正string的赋值运算符是深复制
+            //有这个和const版本就够了，反正message_buffer的赋值运算符是深复制
             char* data(){
-                return const_cast<char*>( m_data.data() );
+                return m_data.data();
             }
 
             const char* body() const{
-                return const_cast<char*>( m_data.data() ) + header_length;
+                return m_data.data() + header_length;
             }
 
             char* body() {
-                return const_cast<char*>( m_data.data() ) + header_length;
+                return m_data.data() + header_length;
             }
 
             std::size_t length() const{
@@ -83,6 +152,20 @@ namespace messageDeal {
                 return m_header.bodySize;
             }
 
+            //同一帧的紧凑帧头，setMessage的时候一起算好，发给协商过的连接时用它代替Header
+            const unsigned char* compact_header() const{
+                return m_compact.bytes;
+            }
+
+            std::size_t compact_header_length() const{
+                return m_compact.length;
+            }
+
+            //用紧凑帧头发出去的时候整帧的长度
+            std::size_t compact_length() const{
+                return m_compact.length + m_header.bodySize;
+            }
+
             void setMessage(int messageType, const std::string& buffer){
                 //assert(buffer.size() <= body_max_length);
                 m_header.bodySize = buffer.size();
@@ -90,8 +173,60 @@ namespace messageDeal {
                 resize(buffer.size() + header_length);
                 std::memcpy(body(), buffer.data(), buffer.size());
                 std::memcpy(data(), &m_header, header_length);
+                m_compact = encode_compact_header(m_header.bodySize, m_header.type);
             } 
 
+            //按Codec把消息直接编码到body里面，不用先转成string再拷一次
+            template <typename Codec>
+            void encode(int messageType, const typename Codec::message_type& message){
+                std::size_t size = Codec::size(message);
+                m_header.bodySize = size;
+                m_header.type = messageType;
+                resize(size + header_length);
+                std::memcpy(data(), &m_header, header_length);
+                m_compact = encode_compact_header(m_header.bodySize, m_header.type);
+                Codec::encode(message, body());
+            }
+
+            //按Codec从body里解码
+            template <typename Codec>
+            bool decode(typename Codec::message_type& message) const{
+                return Codec::decode(body(), body_length(), message);
+            }
+
+            //直接把protobuf消息序列化到body里面
+            bool setMessage(int messageType, const google::protobuf::MessageLite& message){
+                encode<protobuf_codec>(messageType, message);
+                return true;
+            }
+
+            //同一条消息换一种编码的样子(MT_ROOM_INFO和MT_ROOM_INFO_FLAT互换)，没有要的人就是空的
+            //和deflated一样在帧共享出去之前设好
+            const std::shared_ptr<const chat_message>& transcoded() const{
+                return m_transcoded;
+            }
+
+            void set_transcoded(std::shared_ptr<const chat_message> transcoded){
+                m_transcoded = std::move(transcoded);
+            }
+
+            //同一帧压缩过的样子(MT_DEFLATED)，压缩没用的话是空的
+            //要在帧共享出去之前设好，之后就只读了
+            const std::shared_ptr<const chat_message>& deflated() const{
+                return m_deflated;
+            }
+
+            void set_deflated(std::shared_ptr<const chat_message> deflated){
+                m_deflated = std::move(deflated);
+            }
+
+            //按header里的长度从body里解析protobuf消息，直接在原来的内存上读，不拷贝
+            //以前用ParseFromString(body())，要先按'\0'拼一个临时string，
+            //body里有0字节(bytes字段里是合法的)的话后面的内容就被截掉了
+            bool parseBody(google::protobuf::MessageLite& message) const{
+                return decode<protobuf_codec>(message);
+            }
+
             //对header进行分析（其实header就存了body的长度）
             bool decode_header(){
                 //先提取出header
@@ -107,7 +242,28 @@ namespace messageDeal {
 
         private:
             Header m_header;
-            std::string m_data;
+            CompactHeader m_compact;
+            //从内存池里拿的，收发消息的时候不用每次都malloc
+            message_buffer m_data;
+            std::shared_ptr<const chat_message> m_deflated;
+            std::shared_ptr<const chat_message> m_transcoded;
     };
+
+    //广播出去的帧是只读的，编码一次以后所有session的发送队列和历史消息
+    //共享同一份数据，只增加引用计数，不再每个接收者拷贝一次
+    using chat_frame_ptr = std::shared_ptr<const chat_message>;
+
+    //帧和引用计数也从内存池里拿
+    inline chat_frame_ptr make_frame(int messageType, const std::string& buffer){
+        auto frame = std::allocate_shared<chat_message>(pool_allocator<chat_message>());
+        frame->setMessage(messageType, buffer);
+        return frame;
+    }
+
+    inline chat_frame_ptr make_frame(int messageType, const google::protobuf::MessageLite& message){
+        auto frame = std::allocate_shared<chat_message>(pool_allocator<chat_message>());
+        frame->setMessage(messageType, message);
+        return frame;
+    }
 }
 #endif // CHAT_MESSAGE_HPP
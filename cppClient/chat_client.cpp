@@ -1,14 +1,22 @@
 //先是自己的
 #include "chat_message.hpp"
+#include "deflate_codec.hpp"
+#include "frame_decoder.hpp"
+#include "handler_memory.hpp"
+#include "message_dispatch.hpp"
 #include "Protocal.pb.h"
 
 //然后是第三方的
 #include <boost/asio.hpp>
 
 //然后是c++库函数
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <deque>
 #include <iostream>
+#include <limits>
+#include <map>
 #include <thread>
 
 //最后是c库函数
@@ -44,36 +52,26 @@ void showTime(std::tm* theTime) {
 bool parseMessage(const std::string& input, int *type, std::string& outbuffer){
     //string返回的不是迭代器，和历史有关
     auto pos = input.find_first_of(" ");
-    //这一部分负责解析，如果没有空格或者空格位置在第一个（没有头部），认为有错
-    if(pos == std::string::npos || pos == 0)
+    //这一部分负责解析，空格位置在第一个（没有头部），认为有错
+    //没有空格的话整行都是命令，比如"leave"，参数是空的
+    if(pos == 0 || input.empty())
         return false;
+    if(pos == std::string::npos)
+        pos = input.size();
     //不同消息的消息实体不一样
     //比如"BindName ok"
+    //命令名字和对应的protobuf消息都在message_dispatch.hpp的message_traits里，
+    //要加一种命令就在那里加，再把type写进下面的列表
     std::string command = input.substr(0,pos);
-    if(command == "bindname") {
-        std::string name = input.substr(pos+1);
-        //如果type不是空指针,给type赋值
-        if(*type == 0)
-            *type = MT_BIND_NAME;
-        //这里用protobuf
-        PBindName bindInfo;
-        bindInfo.set_name(name);
-        //可以直接吧消息序列化成字符串的
-        //这里outbuffer存的就是body
-        bool ok = bindInfo.SerializeToString(&outbuffer);
-        //如果想得到值，就用bindInfo.name()即可
-        return ok;
-    } else if(command == "chat") {
-        std::string chat = input.substr(pos+1);
-        if(*type == 0)
-            *type = MT_CHAT_INFO;
-        //这里用protobuf
-        PChat info;
-        info.set_information(chat);
-        auto ok = info.SerializeToString(&outbuffer);
-        return ok;
-    }
-    return false;
+    int parsed = 0;
+    std::string argument = pos < input.size() ? input.substr(pos+1) : std::string();
+    if(!command_parser<MT_BIND_NAME, MT_CHAT_INFO, MT_JOIN_ROOM, MT_LEAVE_ROOM, MT_DIRECT,
+        MT_PRESENCE_QUERY, MT_HISTORY_QUERY>::parse(command, argument, parsed, outbuffer))
+        return false;
+    //如果type不是空指针,给type赋值
+    if(*type == 0)
+        *type = parsed;
+    return true;
 }
 
 class chat_client{
@@ -105,6 +103,32 @@ class chat_client{
                     });
         }
 
+        //往前翻历史消息，从上一次翻到的地方接着往前；body是parseMessage填好count的PHistoryQuery
+        void requestHistory(const std::string& body)
+        {
+            boost::asio::post(io_context_,
+                    [this, body]()
+                    {
+                        PHistoryQuery query;
+                        if (!query.ParseFromString(body))
+                            return;
+                        query.set_before_seq(history_before_);
+                        chat_message msg;
+                        msg.setMessage(MT_HISTORY_QUERY, query);
+                        bool write_in_progress = !write_msgs_.empty();
+                        write_msgs_.push_back(msg);
+                        if (!write_in_progress){
+                            do_write();
+                        }
+                    });
+        }
+
+        //换了房间，下一次翻历史消息从新房间join时收到的前面开始
+        void resetHistory()
+        {
+            boost::asio::post(io_context_, [this]() { history_before_ = 0; });
+        }
+
         void close()
         { //这里调用close的时候也调用post
             //就相当于用post生成一个事件，这个事件在io_context的控制下去跑
@@ -121,61 +145,249 @@ class chat_client{
                     [this](boost::system::error_code ec, tcp::endpoint)
                     { //回调函数
                         if (!ec){
-                            do_read_header();
+                            //先问服务器能不能用紧凑帧头、能不能压缩，老的服务器不认识MT_HELLO，不回就一直用Header
+                            PHello hello;
+                            hello.set_features(FEATURE_COMPACT_HEADER | FEATURE_DEFLATE | FEATURE_BATCH | FEATURE_FLAT);
+                            chat_message msg;
+                            msg.setMessage(MT_HELLO, hello);
+                            write(msg);
+                            do_read();
                         }
                     });
         }
 
-        //这里和服务端一样，也是先读头部的信息
-        void do_read_header(){
-            //这里如果不给长度，会有异步触发的问题
-            read_msg_.resize(chat_message::header_length);
-            boost::asio::async_read(socket_, boost::asio::buffer(read_msg_.data(), chat_message::header_length),
-                    [this](boost::system::error_code ec, std::size_t /*length*/){
-                        if (!ec && read_msg_.decode_header()){
-                            //通过头部检查body的合法性
-                            do_read_body();
+        //这里和服务端一样，有多少读多少，读进来的完整的帧一次都处理掉
+        void do_read(){
+            //回调用的内存从read_handler_memory_里拿，每次读都复用
+            socket_.async_read_some(boost::asio::buffer(decoder_.write_data(), decoder_.write_space()),
+                    make_custom_alloc_handler(read_handler_memory_,
+                    [this](boost::system::error_code ec, std::size_t length){
+                        if (ec){
+                            socket_.close();
+                            return;
                         }
-                        else
-                        {   //这里错误处理是关闭连接，为什么是关闭连接呢？
-                            //这是在同一个线程下面的处理，可以直接用close
-                            //而不用io_context去控制
+                        decoder_.commit(length);
+                        frame_view frame;
+                        frame_decoder::result result;
+                        while ((result = decoder_.next(frame)) == frame_decoder::frame_ready)
+                            handleFrame(frame);
+                        if (result == frame_decoder::bad_frame){
                             socket_.close();
+                            return;
                         }
+                        do_read();
+                    }));
+        }
 
-                    });
+        //服务器发下来的消息，type直接查表分发到下面对应的on_message
+        using dispatcher = message_dispatcher<chat_client, MT_ROOM_INFO, MT_HELLO, MT_CHUNK, MT_DEFLATED, MT_BATCH,
+              MT_ROOM_INFO_FLAT, MT_DIRECT, MT_SERVER_ERROR, MT_PRESENCE, MT_HISTORY>;
+        friend dispatcher;
+
+        void handleFrame(const frame_view& frame){
+            dispatcher::dispatch(*this, frame);
         }
 
-        //处理服务器发过来的东西，这里就是定义的RoomInformation
-        void do_read_body(){
-            read_msg_.resize(chat_message::header_length + read_msg_.body_length());
-            boost::asio::async_read(socket_,
-                    boost::asio::buffer(read_msg_.body(), read_msg_.body_length()),
-                    [this](boost::system::error_code ec, std::size_t /*length*/){
-                        if (!ec){
-                            //如果是用protobuf处理:
-                            PRoomInformation roomInfo;
-                            //现在可以从string里面去解析了！
-                            auto ok = roomInfo.ParseFromString(read_msg_.body());
-                            //if(!ok) throw std::runtime_error("not valid message");
-                            if(ok) {
-                                showTime(gettm(roomInfo.time()));
-                                std::cout << "client: '" << roomInfo.name() << "'";
-                                std::cout << "  says : '" << roomInfo.information() << "'" << std::endl;
-                            }else{
-                                std::cout << "serialization error!" << std::endl;
-                            }
-                            do_read_header();
-                        }
-                        else{
-                            socket_.close();
-                        }
-                    });
+        void on_parse_error(const frame_view&){
+            std::cout << "serialization error!" << std::endl;
+        }
+
+        void on_message(const PRoomInformation& roomInfo, const frame_view&){
+            showTime(gettm(roomInfo.time()));
+            std::cout << "client: '" << roomInfo.name() << "'";
+            std::cout << "  says : '" << roomInfo.information() << "'" << std::endl;
+        }
+
+        void on_message(const PDirectMessage& direct, const frame_view&){
+            showTime(gettm(direct.time()));
+            std::cout << "client: '" << direct.from() << "'";
+            std::cout << "  whispers : '" << direct.information() << "'" << std::endl;
+        }
+
+        void on_message(const PServerErrorMessage& error, const frame_view&){
+            if (error.mes() == PServerErrorMessage::UserNotFound)
+                std::cout << "server: user not found" << std::endl;
+            else if (error.mes() == PServerErrorMessage::BodyTooLong)
+                std::cout << "server: message too long" << std::endl;
+            else
+                std::cout << "server error " << error.mes() << std::endl;
+        }
+
+        //名单：整页的时候换掉手上的名单，变化的时候版本号要正好接上，接不上就按手上的版本重新要一次
+        void on_message(const PPresence& presence, const frame_view&){
+            if (presence.snapshot()){
+                if (presence.page() == 0)
+                    members_.clear();
+                for (const PPresenceMember& member: presence.members())
+                    members_[member.id()] = member.name();
+                if (presence.last()){
+                    presence_version_ = presence.version();
+                    resync_pending_ = false;
+                    std::cout << "members (" << members_.size() << "):";
+                    for (const auto& member: members_)
+                        std::cout << " '" << member.second << "'";
+                    std::cout << std::endl;
+                }
+                return;
+            }
+            //还没拿到过名单，或者是已经有了的版本
+            if (presence_version_ == 0 || presence.version() <= presence_version_)
+                return;
+            if (presence.version() != presence_version_ + 1){
+                requestPresence();
+                return;
+            }
+            for (const PPresenceDelta& delta: presence.deltas()){
+                if (delta.kind() == PPresenceDelta::JOIN){
+                    members_[delta.id()] = delta.name();
+                    std::cout << "* '" << delta.name() << "' joined" << std::endl;
+                }else if (delta.kind() == PPresenceDelta::LEAVE){
+                    std::cout << "* '" << members_[delta.id()] << "' left" << std::endl;
+                    members_.erase(delta.id());
+                }else{
+                    std::cout << "* '" << members_[delta.id()] << "' is now '" << delta.name() << "'" << std::endl;
+                    members_[delta.id()] = delta.name();
+                }
+            }
+            presence_version_ = presence.version();
+            resync_pending_ = false;
+        }
+
+        //翻到的历史消息紧跟在这一帧后面，都是用Header的帧，decoder_先按Header拆这么多字节
+        void on_message(const PHistory& history, const frame_view&){
+            decoder_.expect_legacy(history.bytes());
+            if (history.count() > 0){
+                history_before_ = history.first_seq();
+                std::cout << "history: " << history.count() << " messages from #" << history.first_seq() << std::endl;
+            }
+            if (history.last())
+                std::cout << "history: no older messages" << std::endl;
+        }
+
+        void requestPresence(){
+            if (resync_pending_)
+                return;
+            resync_pending_ = true;
+            PPresenceQuery query;
+            query.set_since_version(presence_version_);
+            chat_message msg;
+            msg.setMessage(MT_PRESENCE_QUERY, query);
+            write(msg);
+        }
+
+        //平铺格式的不用解析，name和information直接指向收到的body
+        void on_message(const flat_room_info& info, const frame_view&){
+            showTime(gettm(info.time));
+            std::cout << "client: '";
+            std::cout.write(info.name, info.name_length);
+            std::cout << "'  says : '";
+            std::cout.write(info.information, info.information_length);
+            std::cout << "'" << std::endl;
+        }
+
+        //服务器答应了就切过去，服务器在回这一帧之后发的都是紧凑帧头
+        void on_message(const PHello& hello, const frame_view&){
+            if (hello.features() & FEATURE_COMPACT_HEADER){
+                decoder_.set_compact(true);
+                confirmCompact();
+            }
+        }
+
+        //压缩过的一个单位可能分在几帧里，解完整了再一帧一帧拆出来处理，里面的帧都是紧凑帧头
+        void on_message(raw_body, const frame_view& frame){
+            inflater::result result = inflater_.feed(frame.body, frame.body_length, inflated_);
+            if (result == inflater::failed){
+                std::cout << "decompress error!" << std::endl;
+                return;
+            }
+            if (result == inflater::more)
+                return;
+            std::string unit;
+            unit.swap(inflated_);
+            const char* data = unit.data();
+            std::size_t left = unit.size();
+            frame_view inner;
+            std::size_t length = 0;
+            while (frame_decoder::parse(data, left, true, inner, length) == frame_decoder::frame_ready){
+                if (inner.type != MT_DEFLATED)
+                    handleFrame(inner);
+                data += length;
+                left -= length;
+            }
+        }
+
+        //服务器把积压的几条消息打成了一帧，时间是和上一条的差值
+        void on_message(const PRoomBatch& batch, const frame_view&){
+            std::int64_t time = batch.base_time();
+            for (const PBatchRecord& record: batch.records()){
+                time += record.time_delta();
+                if (record.name_index() >= static_cast<std::uint32_t>(batch.names_size()))
+                    continue;
+                showTime(gettm(time));
+                std::cout << "client: '" << batch.names(record.name_index()) << "'";
+                std::cout << "  says : '" << record.information() << "'" << std::endl;
+            }
+        }
+
+        //分片按index顺序拼起来，最后一片到了再显示
+        //中途加入收到的半截、或者服务器因为积压丢了中间的分片，这条消息就不要了
+        void on_message(const PChunk& chunk, const frame_view&){
+            auto it = chunks_.find(chunk.id());
+            if (it == chunks_.end()){
+                if (chunk.index() != 0)
+                    return;
+                it = chunks_.emplace(chunk.id(), incoming_chunks()).first;
+            }
+            incoming_chunks& incoming = it->second;
+            if (chunk.index() != incoming.next_index
+                    || incoming.data.size() + chunk.data().size() > max_chunked_length){
+                std::cout << "large message from '" << chunk.name() << "' incomplete, dropped" << std::endl;
+                chunks_.erase(it);
+                return;
+            }
+            incoming.data += chunk.data();
+            ++incoming.next_index;
+            if (chunk.last()){
+                showTime(gettm(chunk.time()));
+                std::cout << "client: '" << chunk.name() << "'";
+                std::cout << "  says : '" << incoming.data << "'" << std::endl;
+                chunks_.erase(it);
+            }
+        }
+
+        //再发一次MT_HELLO告诉服务器从下一帧开始换成紧凑帧头
+        //它要排在正在写的那一帧后面、其他还没写的前面，用Header发，写它的时候就切换
+        void confirmCompact(){
+            PHello hello;
+            hello.set_features(FEATURE_COMPACT_HEADER);
+            chat_message msg;
+            msg.setMessage(MT_HELLO, hello);
+            bool write_in_progress = !write_msgs_.empty();
+            write_msgs_.insert(write_msgs_.begin() + (write_in_progress ? 1 : 0), msg);
+            switch_pending_ = true;
+            if (!write_in_progress){
+                do_write();
+            }
         }
 
         //往服务器里面写
+        //协商好以后用紧凑帧头代替chat_message里的Header，帧头和body两块一起写
         void do_write(){
-            boost::asio::async_write(socket_, boost::asio::buffer(write_msgs_.front().data(), write_msgs_.front().length()),
+            const chat_message& msg = write_msgs_.front();
+            if (compact_){
+                write_buffers_[0] = boost::asio::buffer(msg.compact_header(), msg.compact_header_length());
+                write_buffers_[1] = boost::asio::buffer(msg.body(), msg.body_length());
+            }else{
+                write_buffers_[0] = boost::asio::buffer(msg.data(), msg.length());
+                write_buffers_[1] = boost::asio::const_buffer();
+            }
+            //现在写的是确认的那个MT_HELLO，后面的都用紧凑帧头
+            if (switch_pending_){
+                compact_ = true;
+                switch_pending_ = false;
+            }
+            boost::asio::async_write(socket_, write_buffers_,
+                    make_custom_alloc_handler(write_handler_memory_,
                     [this](boost::system::error_code ec, std::size_t /*length*/){
                         if (!ec){
                             write_msgs_.pop_front();
@@ -187,18 +399,64 @@ class chat_client{
                         else{
                             socket_.close();
                         }
-                    });
+                    }));
         }
 
     private:
         //四个成员，前两个负责通信连接的，后两个负责收发消息
         boost::asio::io_context& io_context_;
         tcp::socket socket_;
-        chat_message read_msg_;
+        frame_decoder decoder_;  //接收缓冲区，一次读进来的多帧在这里拆开
         //std::deque<chat_message> == chat_message_queue
         chat_message_queue write_msgs_;
+        std::array<boost::asio::const_buffer, 2> write_buffers_;
+        bool compact_ = false;  //服务器答应了紧凑帧头以后发的帧都用它
+        bool switch_pending_ = false;  //确认的MT_HELLO已经排进队列，写到它的时候切换
+        inflater inflater_;
+        std::string inflated_;  //正在解压的那个单位已经解出来的内容
+        //还没收完的大消息，key是服务器分配的id
+        struct incoming_chunks {
+            std::string data;
+            std::uint32_t next_index = 0;
+        };
+        enum { max_chunked_length = 16 * 1024 * 1024 };
+        std::map<std::uint64_t, incoming_chunks> chunks_;
+        //房间的名单，id到名字，版本号是0表示还没有
+        std::map<std::uint64_t, std::string> members_;
+        std::uint64_t presence_version_ = 0;
+        bool resync_pending_ = false;  //接不上的时候已经要过一次了
+        std::uint64_t history_before_ = 0;  //已经翻到的最早的一条的序号，0表示还没翻过
+        //读和写各留一块内存给asio放回调，不用每次读写都new
+        handler_memory<256> read_handler_memory_;
+        handler_memory<256> write_handler_memory_;
 };
 
+//服务器转发一行聊天的时候带上名字和时间，按平铺和protobuf里大的那个算，超过一帧就要拆分片
+//时间按最长的varint算，宁可早一点拆
+std::size_t relayedSize(const std::string& name, const std::string& text){
+    PRoomInformation info;
+    info.set_name(name);
+    info.set_information(text);
+    info.set_time(std::numeric_limits<std::int64_t>::max());
+    flat_room_info flat{0, name.data(), name.size(), text.data(), text.size()};
+    return std::max<std::size_t>(info.ByteSizeLong(), flat_codec::size(flat));
+}
+
+//一行聊天内容太长，一帧放不下的时候拆成PChunk分片发
+void writeChunks(chat_client& c, std::uint64_t id, const std::string& text){
+    std::uint32_t index = 0;
+    for (std::size_t offset = 0; offset < text.size(); offset += chat_message::chunk_max_data){
+        PChunk chunk;
+        chunk.set_id(id);
+        chunk.set_index(index++);
+        chunk.set_data(text.substr(offset, chat_message::chunk_max_data));
+        chunk.set_last(offset + chat_message::chunk_max_data >= text.size());
+        chat_message msg;
+        msg.setMessage(MT_CHUNK, chunk);
+        c.write(msg);
+    }
+}
+
 int main(int argc, char* argv[])
 {
     try{
@@ -219,15 +477,36 @@ int main(int argc, char* argv[])
 
         std::thread t([&io_context](){ io_context.run(); });
 
-        char line[chat_message::body_max_length+ 1];
-        while (std::cin.getline(line, chat_message::body_max_length + 1)){
+        //一行不再限制长度，超过一帧的聊天内容拆成分片发
+        std::string input;
+        std::string name;  //绑定的名字，算转发以后的大小要用
+        std::uint64_t chunk_id = 0;
+        while (std::getline(std::cin, input)){
             chat_message msg;
             auto type = 0;
-            //这里有点像迭代器，获得line的输入
-            std::string input(line, line + std::strlen(line));
             std::string output;
             //都封装到这个parseMessage里面，整个框架就可以复用了
-            if(parseMessage(input,&type,output)){
+            bool ok = parseMessage(input,&type,output);
+            PChat info;
+            bool chat = ok && type == MT_CHAT_INFO && info.ParseFromString(output);
+            if(ok && type == MT_BIND_NAME){
+                PBindName bindName;
+                if(bindName.ParseFromString(output))
+                    name = bindName.name();
+            }
+            if(ok && (output.size() > chat_message::body_max_length
+                        || (chat && relayedSize(name, info.information()) > chat_message::body_max_length))){
+                if(chat){
+                    writeChunks(c, ++chunk_id, info.information());
+                    std::cout << "write large message for server " << info.information().size() << std::endl;
+                }else{
+                    std::cout << "message too long" << std::endl;
+                }
+            }else if(ok && type == MT_HISTORY_QUERY){
+                c.requestHistory(output);
+            }else if(ok){
+                if(type == MT_JOIN_ROOM || type == MT_LEAVE_ROOM)
+                    c.resetHistory();
                 //parse 把body解析到output里面去，setMessage搞成chat_message的格式
                 msg.setMessage(type, output);
                 c.write(msg);
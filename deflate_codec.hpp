@@ -0,0 +1,203 @@
+#ifndef DEFLATE_CODEC_HPP
+#define DEFLATE_CODEC_HPP
+#include "chat_message.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include <zlib.h>
+
+//协商过FEATURE_DEFLATE的连接，服务器发下去的帧可以是压缩过的
+//压缩的单位是"几个完整的帧拼在一起"，里面的帧一律用紧凑帧头，压缩以后装在MT_DEFLATED帧的body里
+//一条广播消息压缩一次，所有开了压缩的session共用；join时的历史消息整块压缩一次，
+//超过一帧的话拆成几个MT_DEFLATED帧，客户端收到流结束以后再拆出里面的帧
+//用的是raw deflate(没有zlib头和校验)，每个单位都从同一个预置字典开始，帧与帧之间没有依赖，
+//所以哪一帧被丢掉了也不影响后面的
+
+namespace messageDeal {
+
+    //预置字典，聊天消息太短，没有字典的话压缩不了多少
+    //zlib的字典越靠后的内容越便宜，所以最常见的放在最后
+    //PRoomInformation的字段tag(0x08 time、0x12 name、0x1a information)也放进去了
+    inline const std::string& deflate_dictionary(){
+        static const std::string dictionary =
+            "http://https://www..com.cn/ .png.jpg.txt.log error warning exception "
+            "undefined null true false return function class include std::string "
+            "thank you please sorry what where when why how about today tomorrow "
+            "good morning good night see you later haha lol ok okay yes no "
+            "谢谢不客气没问题好的收到在吗哈哈哈是的不是我们你们他们今天明天现在一下什么怎么为什么"
+            "\x08\x12\x1a hello hi the you and ";
+        return dictionary;
+    }
+
+    class deflater {
+        public:
+            deflater() : ok_(false){
+                std::memset(&stream_, 0, sizeof(stream_));
+            }
+
+            ~deflater(){
+                if (ok_)
+                    deflateEnd(&stream_);
+            }
+
+            deflater(const deflater&) = delete;
+            deflater& operator=(const deflater&) = delete;
+
+            //压缩成一个完整的raw deflate流，out原来的内容会被覆盖
+            bool compress(const char* data, std::size_t size, int level, std::string& out){
+                if (!ok_ || level != level_) {
+                    if (ok_)
+                        deflateEnd(&stream_);
+                    //-15是raw deflate，省掉zlib头和adler32
+                    ok_ = deflateInit2(&stream_, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+                    level_ = level;
+                    if (!ok_)
+                        return false;
+                } else if (deflateReset(&stream_) != Z_OK) {
+                    return false;
+                }
+                const std::string& dictionary = deflate_dictionary();
+                deflateSetDictionary(&stream_,
+                        reinterpret_cast<const Bytef*>(dictionary.data()), dictionary.size());
+                out.resize(deflateBound(&stream_, size));
+                stream_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+                stream_.avail_in = size;
+                stream_.next_out = reinterpret_cast<Bytef*>(&out[0]);
+                stream_.avail_out = out.size();
+                if (deflate(&stream_, Z_FINISH) != Z_STREAM_END)
+                    return false;
+                out.resize(out.size() - stream_.avail_out);
+                return true;
+            }
+
+            //deflateInit要分配两百多K的状态，每个线程一个反复用
+            static deflater& local(){
+                static thread_local deflater instance;
+                return instance;
+            }
+
+        private:
+            z_stream stream_;
+            bool ok_;
+            int level_ = 0;
+    };
+
+    //客户端用的，一个压缩单位可能分在好几个MT_DEFLATED帧里，一帧一帧地喂进来
+    class inflater {
+        public:
+            enum result { done, more, failed };
+            //解出来的数据最多这么大，防止被一个很小的压缩包撑爆内存
+            enum { max_output = 16 * 1024 * 1024 };
+
+            inflater() : ok_(false), started_(false){
+                std::memset(&stream_, 0, sizeof(stream_));
+                ok_ = inflateInit2(&stream_, -15) == Z_OK;
+            }
+
+            ~inflater(){
+                if (ok_)
+                    inflateEnd(&stream_);
+            }
+
+            inflater(const inflater&) = delete;
+            inflater& operator=(const inflater&) = delete;
+
+            //返回done的时候out里就是这个单位解压出来的全部内容
+            result feed(const char* data, std::size_t size, std::string& out){
+                if (!ok_)
+                    return failed;
+                if (!started_) {
+                    //raw deflate不会回Z_NEED_DICT，一开始就要把字典设上
+                    const std::string& dictionary = deflate_dictionary();
+                    if (inflateReset(&stream_) != Z_OK
+                            || inflateSetDictionary(&stream_,
+                                reinterpret_cast<const Bytef*>(dictionary.data()), dictionary.size()) != Z_OK)
+                        return failed;
+                    out.clear();
+                    started_ = true;
+                }
+                stream_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+                stream_.avail_in = size;
+                char buffer[4096];
+                for (;;) {
+                    stream_.next_out = reinterpret_cast<Bytef*>(buffer);
+                    stream_.avail_out = sizeof(buffer);
+                    int status = inflate(&stream_, Z_NO_FLUSH);
+                    out.append(buffer, sizeof(buffer) - stream_.avail_out);
+                    if (status == Z_STREAM_END) {
+                        started_ = false;
+                        return stream_.avail_in == 0 ? done : failed;
+                    }
+                    if ((status != Z_OK && status != Z_BUF_ERROR) || out.size() > max_output) {
+                        started_ = false;
+                        return failed;
+                    }
+                    if (stream_.avail_in == 0 && stream_.avail_out != 0)
+                        return more;
+                }
+            }
+
+        private:
+            z_stream stream_;
+            bool ok_;
+            bool started_;  //是不是正在解一个单位的中间
+    };
+
+    //把一帧(紧凑帧头+body)压缩成一个MT_DEFLATED帧，压完没变小就返回空
+    inline chat_frame_ptr deflate_frame(const chat_message& frame, int level){
+        //每个线程留一份，string的容量反复用
+        static thread_local std::string input;
+        static thread_local std::string compressed;
+        input.assign(reinterpret_cast<const char*>(frame.compact_header()), frame.compact_header_length());
+        input.append(frame.body(), frame.body_length());
+        if (!deflater::local().compress(input.data(), input.size(), level, compressed)
+                || compressed.size() >= frame.body_length())
+            return chat_frame_ptr();
+        return make_frame(MT_DEFLATED, compressed);
+    }
+
+    //把拼好的一串帧(紧凑帧头)整块压缩，按body_max_length切成几个MT_DEFLATED帧，
+    //这几帧的帧头按compact选，拼成一整块；压缩失败返回空
+    inline std::shared_ptr<const std::string> deflate_block(const std::string& frames, bool compact, int level){
+        std::string compressed;
+        if (!deflater::local().compress(frames.data(), frames.size(), level, compressed))
+            return std::shared_ptr<const std::string>();
+        auto block = std::make_shared<std::string>();
+        block->reserve(compressed.size() + compressed.size() / chat_message::body_max_length * chat_message::header_length
+                + chat_message::header_length);
+        for (std::size_t offset = 0; offset < compressed.size(); offset += chat_message::body_max_length) {
+            std::size_t size = std::min<std::size_t>(compressed.size() - offset, chat_message::body_max_length);
+            if (compact) {
+                CompactHeader header = encode_compact_header(size, MT_DEFLATED);
+                block->append(reinterpret_cast<const char*>(header.bytes), header.length);
+            } else {
+                Header header{static_cast<std::int32_t>(size), MT_DEFLATED};
+                block->append(reinterpret_cast<const char*>(&header), chat_message::header_length);
+            }
+            block->append(compressed, offset, size);
+        }
+        return block;
+    }
+
+    //按Codec编码一帧，level大于0的时候再压缩一份挂在这一帧上
+    //返回的帧还能改，共享出去之前可以再挂上transcoded
+    template <typename Codec>
+    inline std::shared_ptr<chat_message> encode_frame(int messageType,
+            const typename Codec::message_type& message, int level){
+        auto frame = std::allocate_shared<chat_message>(pool_allocator<chat_message>());
+        frame->encode<Codec>(messageType, message);
+        if (level > 0)
+            frame->set_deflated(deflate_frame(*frame, level));
+        return frame;
+    }
+
+    //和make_frame一样，level大于0的时候再压缩一份挂在这一帧上
+    inline chat_frame_ptr make_frame(int messageType, const google::protobuf::MessageLite& message, int level){
+        return encode_frame<protobuf_codec>(messageType, message, level);
+    }
+}
+#endif // DEFLATE_CODEC_HPP
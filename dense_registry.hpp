@@ -0,0 +1,85 @@
+#ifndef DENSE_REGISTRY_HPP
+#define DENSE_REGISTRY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+//稠密的登记表(slot map)：元素紧挨着放在一个vector里，遍历的时候是线性访问
+//删除的时候把最后一个元素挪到空出来的位置(swap-remove)，插入删除都是O(1)
+//handle是槽位下标加代数(generation)，元素被挪动以后handle还是有效的，
+//删掉以后代数加一，旧的handle就失效了，重复删除也没关系
+//room的sessions_和名单订阅都用它；bench/fanout_bench拿它和std::set比广播时遍历的代价
+
+namespace messageDeal {
+
+    template <typename T>
+    class dense_registry {
+        public:
+            struct handle {
+                std::uint32_t slot = invalid_slot;
+                std::uint32_t generation = 0;
+            };
+
+            handle insert(T value){
+                std::uint32_t slot;
+                if (free_slots_.empty()) {
+                    slot = static_cast<std::uint32_t>(slots_.size());
+                    slots_.push_back(slot_entry());
+                }else {
+                    slot = free_slots_.back();
+                    free_slots_.pop_back();
+                }
+                slots_[slot].dense_index = static_cast<std::uint32_t>(dense_.size());
+                dense_.push_back(std::move(value));
+                dense_slots_.push_back(slot);
+                handle h;
+                h.slot = slot;
+                h.generation = slots_[slot].generation;
+                return h;
+            }
+
+            //handle已经失效的话什么都不做，返回false
+            bool erase(handle h){
+                if (!contains(h))
+                    return false;
+                std::uint32_t index = slots_[h.slot].dense_index;
+                std::uint32_t last = static_cast<std::uint32_t>(dense_.size() - 1);
+                if (index != last) {
+                    //最后一个挪过来，更新它的槽位
+                    dense_[index] = std::move(dense_[last]);
+                    dense_slots_[index] = dense_slots_[last];
+                    slots_[dense_slots_[index]].dense_index = index;
+                }
+                dense_.pop_back();
+                dense_slots_.pop_back();
+                ++slots_[h.slot].generation;
+                free_slots_.push_back(h.slot);
+                return true;
+            }
+
+            bool contains(handle h) const {
+                return h.slot < slots_.size() && slots_[h.slot].generation == h.generation;
+            }
+
+            std::size_t size() const { return dense_.size(); }
+
+            typename std::vector<T>::const_iterator begin() const { return dense_.begin(); }
+            typename std::vector<T>::const_iterator end() const { return dense_.end(); }
+
+        private:
+            enum : std::uint32_t { invalid_slot = 0xffffffffu };
+
+            struct slot_entry {
+                std::uint32_t dense_index = 0;
+                std::uint32_t generation = 0;
+            };
+
+            std::vector<T> dense_;                    //元素本身，连续存放
+            std::vector<std::uint32_t> dense_slots_;  //dense_[i]对应的槽位
+            std::vector<slot_entry> slots_;
+            std::vector<std::uint32_t> free_slots_;
+    };
+}
+#endif // DENSE_REGISTRY_HPP
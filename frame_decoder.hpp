@@ -0,0 +1,145 @@
+#ifndef FRAME_DECODER_HPP
+#define FRAME_DECODER_HPP
+#include "chat_message.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <memory>
+
+//按帧读的时候每一帧都要先读header再读body，两次async_read，
+//客户端连着发50条小消息就是100次系统调用和100次回调
+//这里换成一块大的接收缓冲区，用async_read_some有多少读多少，
+//每次醒过来把里面完整的帧全部拆出来，剩下不完整的半帧留到下一次再拼
+
+namespace messageDeal {
+
+    //缓冲区里的一帧，body直接指向接收缓冲区，只在这一次回调里有效
+    struct frame_view {
+        int type;
+        const char* body;
+        std::size_t body_length;
+
+        //和chat_message::decode一样
+        template <typename Codec>
+        bool decode(typename Codec::message_type& message) const{
+            return Codec::decode(body, body_length, message);
+        }
+
+        //和chat_message::parseBody一样，按长度直接在原来的内存上解析
+        bool parseBody(google::protobuf::MessageLite& message) const{
+            return decode<protobuf_codec>(message);
+        }
+    };
+
+    class frame_decoder {
+        public:
+            //至少要能装下一个最大的帧，这样半帧挪到最前面以后一定能读完整
+            enum { buffer_size = 8192 };
+            static_assert(buffer_size >= chat_message::header_length + chat_message::body_max_length,
+                    "receive buffer must hold a whole frame");
+
+            enum result {
+                frame_ready,    //拆出来一帧
+                need_more,      //剩下的不够一帧，接着读
+                bad_frame       //header不合法，连接该断了
+            };
+
+            frame_decoder()
+                : buffer_(new char[buffer_size]), begin_(0), end_(0), compact_(false), legacy_left_(0) {}
+
+            frame_decoder(const frame_decoder&) = delete;
+            frame_decoder& operator=(const frame_decoder&) = delete;
+
+            //async_read_some往这里读，读之前把剩下的半帧挪到最前面
+            //半帧最多也就一帧那么大，挪一下很便宜
+            char* write_data(){
+                if (begin_ == end_) {
+                    begin_ = end_ = 0;
+                } else if (begin_ > 0) {
+                    std::memmove(buffer_.get(), buffer_.get() + begin_, end_ - begin_);
+                    end_ -= begin_;
+                    begin_ = 0;
+                }
+                return buffer_.get() + end_;
+            }
+
+            std::size_t write_space() const{
+                return buffer_size - end_;
+            }
+
+            //读完以后告诉它读进来多少字节
+            void commit(std::size_t length){
+                end_ += length;
+            }
+
+            //协商好以后切到紧凑帧头，缓冲区里还没拆的帧也按新的格式拆
+            void set_compact(bool compact){
+                compact_ = compact;
+            }
+
+            //接下来的bytes字节不管协商的是什么都按Header拆(MT_HISTORY后面跟着的历史消息)
+            void expect_legacy(std::size_t bytes){
+                legacy_left_ = bytes;
+            }
+
+            //从缓冲区里拆下一帧，拆出来以后frame就指向缓冲区里的这一帧
+            result next(frame_view& frame){
+                std::size_t length = 0;
+                bool legacy = legacy_left_ > 0;
+                result r = parse(buffer_.get() + begin_, end_ - begin_, compact_ && !legacy, frame, length);
+                if (r == frame_ready) {
+                    begin_ += length;
+                    if (legacy)
+                        legacy_left_ -= std::min(length, legacy_left_);
+                }
+                return r;
+            }
+
+            //从data开始拆一帧，length返回这一帧一共占了几个字节
+            //解压出来的一串帧也用它来拆
+            static result parse(const char* data, std::size_t available, bool compact,
+                    frame_view& frame, std::size_t& length){
+                Header header;
+                std::size_t header_length = chat_message::header_length;
+                if (compact) {
+                    int used = decode_compact_header(
+                            reinterpret_cast<const unsigned char*>(data), available, header);
+                    if (used == 0)
+                        return need_more;
+                    if (used < 0) {
+                        std::cout << "bad compact header!!" << std::endl;
+                        return bad_frame;
+                    }
+                    header_length = used;
+                } else {
+                    if (available < chat_message::header_length)
+                        return need_more;
+                    std::memcpy(&header, data, chat_message::header_length);
+                }
+                //和decode_header一样检查长度
+                if (header.bodySize < 0 || header.bodySize > chat_message::body_max_length) {
+                    std::cout << "body size " << header.bodySize << " is too long!!"
+                        << "type is " << header.type << std::endl;
+                    return bad_frame;
+                }
+                std::size_t frame_length = header_length + header.bodySize;
+                if (available < frame_length)
+                    return need_more;
+                frame.type = header.type;
+                frame.body = data + header_length;
+                frame.body_length = header.bodySize;
+                length = frame_length;
+                return frame_ready;
+            }
+
+        private:
+            std::unique_ptr<char[]> buffer_;
+            std::size_t begin_;  //还没处理的数据从这里开始
+            std::size_t end_;    //读进来的数据到这里为止
+            bool compact_;       //帧头是Header还是紧凑帧头
+            std::size_t legacy_left_;  //还有这么多字节要按Header拆
+    };
+}
+#endif // FRAME_DECODER_HPP
@@ -0,0 +1,129 @@
+#ifndef HANDLER_MEMORY_HPP
+#define HANDLER_MEMORY_HPP
+#include "message_buffer.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+//asio每发起一次异步读写，都要分配一块内存存放回调(lambda)和操作的状态，
+//默认就是operator new。一个session同一时间最多只有一个读和一个写在进行，
+//所以给读和写各留一块固定的内存，回调通过associated allocator拿到这块内存，
+//每次读写都复用同一块，不用再去new
+//参考的是asio自带的allocation例子
+
+namespace messageDeal {
+
+    //固定内存被占用或者装不下的次数，这时候会退回到buffer_pool里拿
+    inline std::atomic<std::uint64_t>& handler_memory_fallbacks(){
+        static std::atomic<std::uint64_t> count{0};
+        return count;
+    }
+
+    //Size要能装下asio的操作对象，写操作里面有64块的buffer数组，所以要大一点
+    template <std::size_t Size>
+    class handler_memory {
+        public:
+            handler_memory() : in_use_(false) {}
+
+            handler_memory(const handler_memory&) = delete;
+            handler_memory& operator=(const handler_memory&) = delete;
+
+            void* allocate(std::size_t size){
+                if (!in_use_ && size <= sizeof(storage_)) {
+                    in_use_ = true;
+                    return &storage_;
+                }
+                handler_memory_fallbacks().fetch_add(1, std::memory_order_relaxed);
+                std::size_t capacity = 0;
+                return buffer_pool::allocate(size, capacity);
+            }
+
+            void deallocate(void* pointer, std::size_t size){
+                if (pointer == &storage_) {
+                    in_use_ = false;
+                    return;
+                }
+                std::size_t index = buffer_pool::size_class(size);
+                std::size_t capacity = index == buffer_pool::class_count ? size : buffer_pool::class_size(index);
+                buffer_pool::deallocate(static_cast<char*>(pointer), capacity);
+            }
+
+        private:
+            typename std::aligned_storage<Size>::type storage_;
+            bool in_use_;
+    };
+
+    template <typename T, std::size_t Size>
+    class handler_allocator {
+        public:
+            using value_type = T;
+
+            //模板参数里有Size，allocator_traits推不出来，要自己写rebind
+            template <typename U>
+            struct rebind {
+                using other = handler_allocator<U, Size>;
+            };
+
+            explicit handler_allocator(handler_memory<Size>& memory)
+                : memory_(memory) {}
+
+            template <typename U>
+            handler_allocator(const handler_allocator<U, Size>& other) noexcept
+                : memory_(other.memory_) {}
+
+            bool operator==(const handler_allocator& other) const noexcept {
+                return &memory_ == &other.memory_;
+            }
+
+            bool operator!=(const handler_allocator& other) const noexcept {
+                return &memory_ != &other.memory_;
+            }
+
+            T* allocate(std::size_t n) const {
+                return static_cast<T*>(memory_.allocate(sizeof(T) * n));
+            }
+
+            void deallocate(T* p, std::size_t n) const {
+                memory_.deallocate(p, sizeof(T) * n);
+            }
+
+        private:
+            template <typename, std::size_t> friend class handler_allocator;
+
+            handler_memory<Size>& memory_;
+    };
+
+    //把回调包一层，asio会通过get_allocator找到对应的handler_memory
+    template <typename Handler, std::size_t Size>
+    class custom_alloc_handler {
+        public:
+            using allocator_type = handler_allocator<Handler, Size>;
+
+            custom_alloc_handler(handler_memory<Size>& memory, Handler handler)
+                : memory_(memory),
+                handler_(std::move(handler)) {}
+
+            allocator_type get_allocator() const noexcept {
+                return allocator_type(memory_);
+            }
+
+            template <typename ...Args>
+            void operator()(Args&&... args){
+                handler_(std::forward<Args>(args)...);
+            }
+
+        private:
+            handler_memory<Size>& memory_;
+            Handler handler_;
+    };
+
+    template <typename Handler, std::size_t Size>
+    inline custom_alloc_handler<Handler, Size> make_custom_alloc_handler(
+            handler_memory<Size>& memory, Handler handler){
+        return custom_alloc_handler<Handler, Size>(memory, std::move(handler));
+    }
+}
+#endif // HANDLER_MEMORY_HPP
@@ -0,0 +1,298 @@
+#ifndef MESSAGE_BUFFER_HPP
+#define MESSAGE_BUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <vector>
+
+//chat_message用的内存池
+//每一帧的收发都要一块内存，直接用string的话每次都要走malloc
+//这里按大小分几档，每个线程每一档一个空闲链表，用完的块挂回去下次接着用，
+//线程之间不共享所以不用加锁；稳定以后收发消息就不会再调malloc了
+//多线程的时候帧常常在一个线程分配、在另一个线程释放，一边的链表会满、另一边会空，
+//所以满了的时候整批(batch_size块)交给全局的仓库(depot)，空了的时候再整批拿回来，
+//锁只在整批交换的时候才用一次
+
+namespace messageDeal {
+
+    //内存池的统计，所有线程一起累加，只是用来观察
+    struct buffer_pool_stats {
+        std::atomic<std::uint64_t> hits{0};     //从空闲链表里拿到的
+        std::atomic<std::uint64_t> mallocs{0};  //链表是空的，真的去分配的
+        std::atomic<std::uint64_t> frees{0};    //链表满了，真的释放掉的
+    };
+
+    inline buffer_pool_stats& pool_stats(){
+        static buffer_pool_stats stats;
+        return stats;
+    }
+
+    class buffer_pool {
+        public:
+            //最大的一档要能装下header+body_max_length再加结尾的'\0'
+            enum { class_count = 4 };
+            //每个线程每一档最多留这么多块，满了就把batch_size块交给仓库
+            enum { max_cached = 1024 };
+            enum { batch_size = 256 };
+            //仓库里每一档最多留这么多批，再多就还给系统
+            enum { max_depot_batches = 64 };
+
+            static std::size_t class_size(std::size_t index){
+                static const std::size_t sizes[class_count] = { 64, 256, 1024, 2048 };
+                return sizes[index];
+            }
+
+            //能装下size的最小一档，太大了返回class_count
+            static std::size_t size_class(std::size_t size){
+                for (std::size_t i = 0; i < class_count; ++i) {
+                    if (size <= class_size(i))
+                        return i;
+                }
+                return class_count;
+            }
+
+            //capacity返回实际给的大小，释放的时候要传回来
+            static char* allocate(std::size_t size, std::size_t& capacity){
+                std::size_t index = size_class(size);
+                if (index == class_count) {
+                    //超过最大一档的不进池子
+                    capacity = size;
+                    pool_stats().mallocs.fetch_add(1, std::memory_order_relaxed);
+                    return static_cast<char*>(::operator new(size));
+                }
+                capacity = class_size(index);
+                thread_cache* cache = local_cache();
+                if (cache && !cache->heads[index])
+                    refill(*cache, index);
+                if (cache && cache->heads[index]) {
+                    free_block* block = cache->heads[index];
+                    cache->heads[index] = block->next;
+                    --cache->counts[index];
+                    pool_stats().hits.fetch_add(1, std::memory_order_relaxed);
+                    return reinterpret_cast<char*>(block);
+                }
+                pool_stats().mallocs.fetch_add(1, std::memory_order_relaxed);
+                return static_cast<char*>(::operator new(capacity));
+            }
+
+            //可以在任意线程上释放，块会挂到释放它的那个线程的链表上
+            static void deallocate(char* p, std::size_t capacity){
+                if (!p)
+                    return;
+                std::size_t index = size_class(capacity);
+                thread_cache* cache = local_cache();
+                if (index < class_count && cache && cache->counts[index] >= max_cached)
+                    flush(*cache, index);
+                if (index < class_count && cache && cache->counts[index] < max_cached) {
+                    free_block* block = reinterpret_cast<free_block*>(p);
+                    block->next = cache->heads[index];
+                    cache->heads[index] = block;
+                    ++cache->counts[index];
+                    return;
+                }
+                pool_stats().frees.fetch_add(1, std::memory_order_relaxed);
+                ::operator delete(p);
+            }
+
+        private:
+            struct free_block {
+                free_block* next;
+            };
+
+            struct thread_cache {
+                free_block* heads[class_count] = {};
+                std::size_t counts[class_count] = {};
+
+                //线程退出的时候把链表上的块都还回去，不然内存检测工具会报泄漏
+                ~thread_cache(){
+                    destroyed() = true;
+                    for (std::size_t i = 0; i < class_count; ++i) {
+                        while (heads[i]) {
+                            free_block* next = heads[i]->next;
+                            ::operator delete(heads[i]);
+                            heads[i] = next;
+                        }
+                    }
+                }
+            };
+
+            //全局仓库，每一档一个，存的是一批一批串好的链表
+            struct depot {
+                std::mutex mutex;
+                std::vector<free_block*> batches[class_count];
+
+                ~depot(){
+                    for (auto& list: batches) {
+                        for (free_block* batch: list) {
+                            while (batch) {
+                                free_block* next = batch->next;
+                                ::operator delete(batch);
+                                batch = next;
+                            }
+                        }
+                    }
+                }
+            };
+
+            static depot& global_depot(){
+                static depot d;
+                return d;
+            }
+
+            //本线程链表空了，从仓库拿一整批
+            static void refill(thread_cache& cache, std::size_t index){
+                depot& d = global_depot();
+                std::lock_guard<std::mutex> lock(d.mutex);
+                if (d.batches[index].empty())
+                    return;
+                cache.heads[index] = d.batches[index].back();
+                cache.counts[index] = batch_size;
+                d.batches[index].pop_back();
+            }
+
+            //本线程链表满了，摘下前batch_size块交给仓库，仓库也满了就还给系统
+            static void flush(thread_cache& cache, std::size_t index){
+                free_block* batch = cache.heads[index];
+                free_block* last = batch;
+                for (std::size_t i = 1; i < batch_size; ++i)
+                    last = last->next;
+                cache.heads[index] = last->next;
+                cache.counts[index] -= batch_size;
+                last->next = nullptr;
+                {
+                    depot& d = global_depot();
+                    std::lock_guard<std::mutex> lock(d.mutex);
+                    if (d.batches[index].size() < max_depot_batches) {
+                        d.batches[index].push_back(batch);
+                        return;
+                    }
+                }
+                while (batch) {
+                    free_block* next = batch->next;
+                    pool_stats().frees.fetch_add(1, std::memory_order_relaxed);
+                    ::operator delete(batch);
+                    batch = next;
+                }
+            }
+
+            //线程退出时cache已经析构了还有消息在释放的话，就直接走系统的释放
+            //bool是平凡析构的，一直都能访问
+            static bool& destroyed(){
+                static thread_local bool flag = false;
+                return flag;
+            }
+
+            static thread_cache* local_cache(){
+                if (destroyed())
+                    return nullptr;
+                static thread_local thread_cache cache;
+                return &cache;
+            }
+    };
+
+    //一块从buffer_pool里拿的连续内存，用法和string差不多
+    //resize会保留原来的内容，拷贝的时候也从池子里拿
+    //和string一样末尾多留一个'\0'，当成c字符串用也不会越界
+    class message_buffer {
+        public:
+            message_buffer()
+                : data_(nullptr), size_(0), capacity_(0) {}
+
+            message_buffer(const message_buffer& other)
+                : data_(nullptr), size_(0), capacity_(0){
+                    resize(other.size_);
+                    if (size_)
+                        std::memcpy(data_, other.data_, size_);
+                }
+
+            message_buffer(message_buffer&& other) noexcept
+                : data_(other.data_), size_(other.size_), capacity_(other.capacity_){
+                    other.data_ = nullptr;
+                    other.size_ = other.capacity_ = 0;
+                }
+
+            message_buffer& operator=(const message_buffer& other){
+                if (this != &other) {
+                    //只用到size_个字节，不用保留原来的内容
+                    size_ = 0;
+                    resize(other.size_);
+                    if (size_)
+                        std::memcpy(data_, other.data_, size_);
+                }
+                return *this;
+            }
+
+            message_buffer& operator=(message_buffer&& other) noexcept{
+                if (this != &other) {
+                    buffer_pool::deallocate(data_, capacity_);
+                    data_ = other.data_;
+                    size_ = other.size_;
+                    capacity_ = other.capacity_;
+                    other.data_ = nullptr;
+                    other.size_ = other.capacity_ = 0;
+                }
+                return *this;
+            }
+
+            ~message_buffer(){
+                buffer_pool::deallocate(data_, capacity_);
+            }
+
+            char* data() { return data_; }
+            const char* data() const { return data_; }
+            std::size_t size() const { return size_; }
+
+            void resize(std::size_t size){
+                if (size + 1 > capacity_) {
+                    std::size_t capacity = 0;
+                    char* bigger = buffer_pool::allocate(size + 1, capacity);
+                    if (size_)
+                        std::memcpy(bigger, data_, size_);
+                    buffer_pool::deallocate(data_, capacity_);
+                    data_ = bigger;
+                    capacity_ = capacity;
+                }
+                size_ = size;
+                data_[size_] = '\0';
+            }
+
+        private:
+            char* data_;
+            std::size_t size_;
+            std::size_t capacity_;
+    };
+
+    //给allocate_shared用的分配器，共享的帧连同引用计数一起从池子里拿
+    template <typename T>
+    class pool_allocator {
+        public:
+            using value_type = T;
+
+            pool_allocator() = default;
+            template <typename U>
+            pool_allocator(const pool_allocator<U>&) {}
+
+            T* allocate(std::size_t n){
+                std::size_t capacity = 0;
+                return reinterpret_cast<T*>(buffer_pool::allocate(n * sizeof(T), capacity));
+            }
+
+            //同样的大小一定落在同一档，不用记capacity
+            void deallocate(T* p, std::size_t n){
+                std::size_t bytes = n * sizeof(T);
+                std::size_t index = buffer_pool::size_class(bytes);
+                std::size_t capacity = index == buffer_pool::class_count ? bytes : buffer_pool::class_size(index);
+                buffer_pool::deallocate(reinterpret_cast<char*>(p), capacity);
+            }
+    };
+
+    template <typename T, typename U>
+    bool operator==(const pool_allocator<T>&, const pool_allocator<U>&) { return true; }
+    template <typename T, typename U>
+    bool operator!=(const pool_allocator<T>&, const pool_allocator<U>&) { return false; }
+}
+#endif // MESSAGE_BUFFER_HPP
@@ -0,0 +1,91 @@
+#ifndef MESSAGE_CODEC_HPP
+#define MESSAGE_CODEC_HPP
+#include "Protocal.pb.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+//chat_message的body怎么编码解码，做成策略类，chat_message::encode<Codec>/decode<Codec>按它来
+//每个策略提供：
+//    message_type                              能编码的消息类型
+//    size(message)                             编码以后的长度
+//    encode(message, out)                      写进out，out至少有size()那么大
+//    decode(data, size, message)               从body解码，失败返回false
+//protobuf_codec是原来的做法；flat_codec是给广播用的平铺格式，
+//字段在固定的位置，收到以后不用解析，直接在body上读
+
+namespace messageDeal {
+
+    struct protobuf_codec {
+        using message_type = google::protobuf::MessageLite;
+
+        static std::size_t size(const message_type& message){
+            return message.ByteSizeLong();
+        }
+
+        //ByteSizeLong已经把大小缓存下来了，要先调size()，这里不用再算一遍
+        static void encode(const message_type& message, char* out){
+            message.SerializeWithCachedSizesToArray(reinterpret_cast<std::uint8_t*>(out));
+        }
+
+        //按长度直接在原来的内存上解析，不拷贝
+        static bool decode(const char* data, std::size_t size, message_type& message){
+            return message.ParseFromArray(data, static_cast<int>(size));
+        }
+    };
+
+    //MT_ROOM_INFO_FLAT的body，和PRoomInformation是同样的内容
+    //解码出来的name和information直接指向body，只在那一帧还在的时候有效
+    struct flat_room_info {
+        std::int64_t time;
+        const char* name;
+        std::size_t name_length;
+        const char* information;
+        std::size_t information_length;
+    };
+
+    //布局：time(8字节) name长度(2字节) name information，information一直到body结束
+    //整数和Header一样按本机字节序
+    struct flat_codec {
+        using message_type = flat_room_info;
+
+        enum { fixed_length = sizeof(std::int64_t) + sizeof(std::uint16_t) };
+        enum { max_name_length = 0xffff };  //再长的名字截掉
+
+        static std::size_t size(const message_type& message){
+            return fixed_length + name_length(message) + message.information_length;
+        }
+
+        static void encode(const message_type& message, char* out){
+            std::uint16_t length = static_cast<std::uint16_t>(name_length(message));
+            std::memcpy(out, &message.time, sizeof(message.time));
+            std::memcpy(out + sizeof(message.time), &length, sizeof(length));
+            out += fixed_length;
+            std::memcpy(out, message.name, length);
+            std::memcpy(out + length, message.information, message.information_length);
+        }
+
+        static bool decode(const char* data, std::size_t size, message_type& message){
+            if (size < fixed_length)
+                return false;
+            std::uint16_t length;
+            std::memcpy(&message.time, data, sizeof(message.time));
+            std::memcpy(&length, data + sizeof(message.time), sizeof(length));
+            if (length > size - fixed_length)
+                return false;
+            message.name = data + fixed_length;
+            message.name_length = length;
+            message.information = message.name + length;
+            message.information_length = size - fixed_length - length;
+            return true;
+        }
+
+        private:
+            static std::size_t name_length(const message_type& message){
+                return std::min<std::size_t>(message.name_length, max_name_length);
+            }
+    };
+}
+#endif // MESSAGE_CODEC_HPP
@@ -0,0 +1,268 @@
+#ifndef MESSAGE_DISPATCH_HPP
+#define MESSAGE_DISPATCH_HPP
+#include "chat_message.hpp"
+#include "frame_decoder.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <utility>
+
+//消息类型和protobuf类型的对应关系，服务器和客户端共用
+//以前加一种消息要改handleMessage的if/else、客户端的parseMessage好几个地方，
+//现在在下面加一个message_traits的特化，再在用到它的地方把类型写进dispatcher的列表里就行
+//分发是编译期生成的一张函数指针表，按type直接下标跳过去，没有虚函数
+
+namespace messageDeal {
+
+    //body不是protobuf的消息（比如MT_DEFLATED），handler直接拿frame_view自己处理
+    struct raw_body {};
+
+    template <int Type>
+    struct message_traits;
+
+    //客户端从命令行能发的消息多两个东西：命令的名字，和把命令后面的参数填进消息
+    template <>
+    struct message_traits<MT_BIND_NAME> {
+        using type = chat::information::PBindName;
+        static const char* command() { return "bindname"; }
+        static void fill(type& message, std::string argument) { message.set_name(std::move(argument)); }
+    };
+
+    template <>
+    struct message_traits<MT_CHAT_INFO> {
+        using type = chat::information::PChat;
+        static const char* command() { return "chat"; }
+        static void fill(type& message, std::string argument) { message.set_information(std::move(argument)); }
+    };
+
+    template <>
+    struct message_traits<MT_ROOM_INFO> {
+        using type = chat::information::PRoomInformation;
+    };
+
+    template <>
+    struct message_traits<MT_HELLO> {
+        using type = chat::information::PHello;
+    };
+
+    template <>
+    struct message_traits<MT_CHUNK> {
+        using type = chat::information::PChunk;
+    };
+
+    template <>
+    struct message_traits<MT_DEFLATED> {
+        using type = raw_body;
+    };
+
+    template <>
+    struct message_traits<MT_BATCH> {
+        using type = chat::information::PRoomBatch;
+    };
+
+    template <>
+    struct message_traits<MT_ROOM_INFO_FLAT> {
+        using type = flat_room_info;
+    };
+
+    template <>
+    struct message_traits<MT_JOIN_ROOM> {
+        using type = chat::information::PJoinRoom;
+        static const char* command() { return "join"; }
+        static void fill(type& message, std::string argument) { message.set_room(std::move(argument)); }
+    };
+
+    //"leave"后面不用跟参数
+    template <>
+    struct message_traits<MT_LEAVE_ROOM> {
+        using type = chat::information::PLeaveRoom;
+        static const char* command() { return "leave"; }
+        static void fill(type&, std::string) {}
+    };
+
+    //"dm 名字 内容"，第一个空格前面是发给谁
+    template <>
+    struct message_traits<MT_DIRECT> {
+        using type = chat::information::PDirectMessage;
+        static const char* command() { return "dm"; }
+        static void fill(type& message, std::string argument){
+            auto pos = argument.find(' ');
+            if (pos == std::string::npos) {
+                message.set_to(std::move(argument));
+                return;
+            }
+            message.set_to(argument.substr(0, pos));
+            message.set_information(argument.substr(pos + 1));
+        }
+    };
+
+    template <>
+    struct message_traits<MT_SERVER_ERROR> {
+        using type = chat::information::PServerErrorMessage;
+    };
+
+    //"who"看一次名单，"who watch"看名单并且订阅变化，"who unwatch"退订
+    template <>
+    struct message_traits<MT_PRESENCE_QUERY> {
+        using type = chat::information::PPresenceQuery;
+        static const char* command() { return "who"; }
+        static void fill(type& message, std::string argument){
+            if (argument == "watch")
+                message.set_subscription(type::SUBSCRIBE);
+            else if (argument == "unwatch")
+                message.set_subscription(type::UNSUBSCRIBE);
+        }
+    };
+
+    template <>
+    struct message_traits<MT_PRESENCE> {
+        using type = chat::information::PPresence;
+    };
+
+    //"history"往前翻20条，"history 50"翻50条；从哪里开始翻由客户端按上一次翻到的地方填
+    template <>
+    struct message_traits<MT_HISTORY_QUERY> {
+        using type = chat::information::PHistoryQuery;
+        static const char* command() { return "history"; }
+        static void fill(type& message, std::string argument){
+            unsigned long count = std::strtoul(argument.c_str(), nullptr, 10);
+            message.set_count(count == 0 ? 20 : static_cast<std::uint32_t>(count));
+        }
+    };
+
+    template <>
+    struct message_traits<MT_HISTORY> {
+        using type = chat::information::PHistory;
+    };
+
+    //Handler要对列表里的每种消息提供
+    //    void on_message(Proto& message, const frame_view& frame)     protobuf的消息
+    //    void on_message(raw_body, const frame_view& frame)           body不是protobuf的
+    //    void on_message(flat_room_info&, const frame_view& frame)    平铺格式的
+    //还有解析失败的时候调用的 void on_parse_error(const frame_view& frame)
+    //不在列表里的type什么都不做，dispatch返回false
+    //不同的type按protobuf类型重载，所以列表里的type要对应不同的protobuf类型
+    template <typename Handler, int... Types>
+    class message_dispatcher {
+        public:
+            //arena不为空的时候protobuf对象在arena上分配，不然就放在栈上
+            static bool dispatch(Handler& handler, const frame_view& frame,
+                    google::protobuf::Arena* arena = nullptr){
+                if (frame.type < 0 || static_cast<std::size_t>(frame.type) >= table_size)
+                    return false;
+                entry call = table()[frame.type];
+                if (!call)
+                    return false;
+                call(handler, frame, arena);
+                return true;
+            }
+
+        private:
+            using entry = void (*)(Handler&, const frame_view&, google::protobuf::Arena*);
+
+            static constexpr int max_type(){
+                int result = 0;
+                for (int type: {Types...}) {
+                    if (type > result)
+                        result = type;
+                }
+                return result;
+            }
+
+            static constexpr bool registered(int type){
+                for (int t: {Types...}) {
+                    if (t == type)
+                        return true;
+                }
+                return false;
+            }
+
+            static constexpr std::size_t table_size = max_type() + 1;
+
+            template <typename Message>
+            static void invoke(Handler& handler, const frame_view& frame, google::protobuf::Arena* arena, Message*){
+                if (arena) {
+                    Message* message = google::protobuf::Arena::CreateMessage<Message>(arena);
+                    if (frame.parseBody(*message))
+                        handler.on_message(*message, frame);
+                    else
+                        handler.on_parse_error(frame);
+                } else {
+                    Message message;
+                    if (frame.parseBody(message))
+                        handler.on_message(message, frame);
+                    else
+                        handler.on_parse_error(frame);
+                }
+            }
+
+            static void invoke(Handler& handler, const frame_view& frame, google::protobuf::Arena*, raw_body*){
+                handler.on_message(raw_body(), frame);
+            }
+
+            //平铺格式解码出来的是指向body的视图，放在栈上就行
+            static void invoke(Handler& handler, const frame_view& frame, google::protobuf::Arena*, flat_room_info*){
+                flat_room_info message;
+                if (frame.decode<flat_codec>(message))
+                    handler.on_message(message, frame);
+                else
+                    handler.on_parse_error(frame);
+            }
+
+            template <int Type>
+            static void call(Handler& handler, const frame_view& frame, google::protobuf::Arena* arena){
+                invoke(handler, frame, arena, static_cast<typename message_traits<Type>::type*>(nullptr));
+            }
+
+            //没登记的type在表里是空指针，也不会去实例化message_traits<Type>
+            template <int Type>
+            static constexpr entry make_entry(std::true_type) { return &call<Type>; }
+            template <int Type>
+            static constexpr entry make_entry(std::false_type) { return nullptr; }
+
+            template <std::size_t... Index>
+            static constexpr std::array<entry, table_size> make_table(std::index_sequence<Index...>){
+                return {{ make_entry<static_cast<int>(Index)>(
+                        std::integral_constant<bool, registered(static_cast<int>(Index))>())... }};
+            }
+
+            static const std::array<entry, table_size>& table(){
+                static constexpr std::array<entry, table_size> entries =
+                    make_table(std::make_index_sequence<table_size>());
+                return entries;
+            }
+    };
+
+    //客户端的命令行：第一个单词是命令的名字，后面的是参数，
+    //按列表里各个type的message_traits::command()找到对应的消息，填好以后序列化成body
+    template <int... Types>
+    class command_parser {
+        public:
+            static bool parse(const std::string& command, std::string argument, int& type, std::string& body){
+                bool ok = false;
+                bool found = false;
+                //C++14没有折叠表达式，用初始化列表按顺序展开
+                int expand[] = { 0, (found || (found = try_one<Types>(command, argument, type, body, ok)), 0)... };
+                (void)expand;
+                return found && ok;
+            }
+
+        private:
+            template <int Type>
+            static bool try_one(const std::string& command, std::string& argument,
+                    int& type, std::string& body, bool& ok){
+                using traits = message_traits<Type>;
+                if (command != traits::command())
+                    return false;
+                typename traits::type message;
+                traits::fill(message, std::move(argument));
+                type = Type;
+                ok = message.SerializeToString(&body);
+                return true;
+            }
+    };
+}
+#endif // MESSAGE_DISPATCH_HPP
@@ -0,0 +1,746 @@
+#ifndef MESSAGE_LOG_HPP
+#define MESSAGE_LOG_HPP
+#include "chat_message.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//房间的消息落盘，服务器重启以后历史消息还在
+//每个房间一个目录，里面是一串段文件(segment)，文件名是第一条消息的序号，
+//段文件整段mmap进来以后往后面追加，磁盘空间从4K开始按需分配、每次翻一倍，最多到段的大小，写满了再开下一个
+//只有一条消息的房间只占4K磁盘
+//段文件里的每条记录就是那一帧本来的样子(Header+body)，一段里的记录首尾相接，
+//一个序号范围在文件里是连续的一段字节，可以直接读出来发出去
+//每index_interval条记一个(序号, 偏移)，按序号找记录的时候从最近的那个往后数几个帧头就到了
+//
+//写盘都在一个后台线程上：广播的时候只是把(房间的日志, 帧)放进队列，不碰磁盘
+//后台线程把队列里的一批帧拷进mmap，攒够commit_bytes或者等到commit_interval再一起msync(group commit)，
+//几个房间的几百条消息一次刷盘；刷完以后把已经落盘的长度写进段文件头，
+//重启的时候只认这个长度以内的记录，刷盘之前断电写了一半的帧不会被当成消息
+//
+//一段时间没有读写的房间日志由日志线程关掉(close和munmap)，记录数和索引留着，再用到的时候只是重新open和mmap，
+//房间很多的时候fd和映射只跟最近活跃的房间数有关；同一个目录同时只有一个room_log在写，见message_log::open
+//目录里已有的段第一次用到的时候才扫，不在建房间的锁里
+
+namespace messageDeal {
+
+    struct message_log_stats {
+        std::atomic<bool> enabled{false};
+        std::atomic<std::uint64_t> records{0};  //写进日志的帧数
+        std::atomic<std::uint64_t> bytes{0};
+        std::atomic<std::uint64_t> commits{0};  //group commit的次数，每次把这期间写过的段刷一遍
+        std::atomic<long> pending{0};           //在队列里还没写进去的帧数
+        std::atomic<std::uint64_t> failures{0}; //建段文件、刷盘失败的次数
+        std::atomic<long> segments{0};          //打开着的段文件数，每个占一个fd和一段映射
+    };
+
+    inline message_log_stats& log_stats(){
+        static message_log_stats stats;
+        return stats;
+    }
+
+    //一个段文件，按段的大小(capacity)整段mmap进来，文件本身只分配到allocated_
+    //文件头：magic(8字节) 第一条的序号(8字节) 已经落盘的长度(8字节)，后面空着到header_length
+    //records_、size_和index_由日志线程在room_log的锁里改，别的线程也在那把锁里读；
+    //size_以内的字节写完就不会再改，拿到size_以后可以在锁外面读
+    class log_segment {
+        public:
+            enum { header_length = 64 };
+            enum { index_interval = 64 };
+            enum { grow_step = 4096 };  //新段先分配一页，之后每次翻倍
+
+            ~log_segment(){
+                if (data_)
+                    munmap(data_, capacity_);
+                ::close(fd_);
+                log_stats().segments.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            log_segment(const log_segment&) = delete;
+            log_segment& operator=(const log_segment&) = delete;
+
+            //新建一个段，最多写到capacity，先分配grow_step
+            static std::shared_ptr<log_segment> create(const std::string& path, std::uint64_t base_seq, std::size_t capacity){
+                int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+                if (fd < 0)
+                    return std::shared_ptr<log_segment>();
+                std::shared_ptr<log_segment> segment(new log_segment(fd, capacity, 0));
+                if (!segment->map() || !segment->reserve(0))
+                    return std::shared_ptr<log_segment>();
+                std::memcpy(segment->data_, magic(), magic_length);
+                std::memcpy(segment->data_ + base_offset, &base_seq, sizeof(base_seq));
+                segment->base_seq_ = base_seq;
+                segment->set_committed(header_length);
+                segment->index_.emplace_back(base_seq, static_cast<std::uint32_t>(header_length));
+                return segment;
+            }
+
+            //打开一个已有的段，按文件头里落盘的长度把记录数一遍，顺便把索引建好
+            //最后一段打开以后还会接着写，capacity和新建的时候一样；以前整段分配好的文件就按文件的大小
+            static std::shared_ptr<log_segment> open(const std::string& path, std::size_t capacity){
+                int fd = ::open(path.c_str(), O_RDWR | O_CLOEXEC);
+                if (fd < 0)
+                    return std::shared_ptr<log_segment>();
+                struct stat st;
+                if (fstat(fd, &st) != 0 || st.st_size < header_length) {
+                    ::close(fd);
+                    return std::shared_ptr<log_segment>();
+                }
+                std::size_t size = static_cast<std::size_t>(st.st_size);
+                std::shared_ptr<log_segment> segment(new log_segment(fd, std::max(capacity, size), size));
+                if (!segment->map() || std::memcmp(segment->data_, magic(), magic_length) != 0)
+                    return std::shared_ptr<log_segment>();
+                std::uint64_t committed;
+                std::memcpy(&segment->base_seq_, segment->data_ + base_offset, sizeof(std::uint64_t));
+                std::memcpy(&committed, segment->data_ + committed_offset, sizeof(committed));
+                segment->recover(std::min<std::uint64_t>(committed, segment->allocated_));
+                return segment;
+            }
+
+            //关掉的段留下来的样子，再打开的时候照着恢复，不用把记录重新数一遍
+            struct state {
+                std::uint64_t base_seq;
+                std::uint64_t records;
+                std::size_t size;
+                std::size_t capacity;
+                std::size_t allocated;
+                std::vector<std::pair<std::uint64_t, std::uint32_t>> index;
+            };
+
+            //只在刷完盘以后调用
+            state save() const {
+                return state{base_seq_, records_, size_, capacity_, allocated_, index_};
+            }
+
+            //重新打开save过的段，文件头对不上(被换掉了)的话返回空
+            static std::shared_ptr<log_segment> reopen(const std::string& path, state saved){
+                int fd = ::open(path.c_str(), O_RDWR | O_CLOEXEC);
+                if (fd < 0)
+                    return std::shared_ptr<log_segment>();
+                std::shared_ptr<log_segment> segment(new log_segment(fd, saved.capacity, saved.allocated));
+                if (!segment->map() || std::memcmp(segment->data_, magic(), magic_length) != 0
+                        || std::memcmp(segment->data_ + base_offset, &saved.base_seq, sizeof(saved.base_seq)) != 0)
+                    return std::shared_ptr<log_segment>();
+                segment->base_seq_ = saved.base_seq;
+                segment->records_ = saved.records;
+                segment->size_ = saved.size;
+                segment->synced_ = saved.size;
+                segment->index_ = std::move(saved.index);
+                return segment;
+            }
+
+            std::uint64_t base_seq() const { return base_seq_; }
+            //下一条记录的序号
+            std::uint64_t end_seq() const { return base_seq_ + records_; }
+            std::uint64_t records() const { return records_; }
+            std::size_t size() const { return size_; }
+            std::size_t space() const { return capacity_ - size_; }
+            const char* data() const { return data_; }
+            int fd() const { return fd_; }
+
+            //只在日志线程上调用：后面再写length字节之前把文件的空间分配好，
+            //写mmap的地方都在文件以内，不会因为磁盘满了收到SIGBUS；超过capacity或者分配失败返回false
+            bool reserve(std::size_t length){
+                std::size_t need = size_ + length;
+                if (need <= allocated_)
+                    return true;
+                if (need > capacity_)
+                    return false;
+                std::size_t target = std::min(capacity_,
+                        std::max<std::size_t>({need, allocated_ * 2, grow_step}));
+                if (posix_fallocate(fd_, allocated_, target - allocated_) != 0)
+                    return false;
+                allocated_ = target;
+                return true;
+            }
+
+            //只在日志线程上调用，reserve过的时候才调用
+            void append(const char* frame, std::size_t length){
+                if (records_ % index_interval == 0 && records_ > 0)
+                    index_.emplace_back(end_seq(), static_cast<std::uint32_t>(size_));
+                std::memcpy(data_ + size_, frame, length);
+                size_ += length;
+                ++records_;
+            }
+
+            //这一段里序号为seq的记录的偏移，seq是end_seq()的话返回size()
+            std::size_t offset_of(std::uint64_t seq) const {
+                if (seq >= end_seq())
+                    return size_;
+                const auto& mark = index_[(seq - base_seq_) / index_interval];
+                std::size_t offset = mark.second;
+                for (std::uint64_t i = mark.first; i < seq; ++i)
+                    offset += record_length(data_ + offset);
+                return offset;
+            }
+
+            //只在日志线程上调用，把上次刷盘以后写的刷下去，再更新文件头里落盘的长度
+            bool sync(){
+                if (synced_ == size_)
+                    return true;
+                std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+                std::size_t begin = synced_ / page * page;
+                bool ok = msync(data_ + begin, size_ - begin, MS_SYNC) == 0;
+                if (ok) {
+                    set_committed(size_);
+                    ok = msync(data_, header_length, MS_SYNC) == 0;
+                }
+                synced_ = size_;
+                return ok;
+            }
+
+            static std::size_t record_length(const char* record){
+                Header header;
+                std::memcpy(&header, record, sizeof(header));
+                return sizeof(header) + header.bodySize;
+            }
+
+            //写进去和恢复的时候都按这一条认记录：帧头完整、type和长度不是负的、整条在available以内
+            //不按body_max_length卡，服务器自己发的大一些的帧(比如分片转发)也照样写、照样认
+            static bool valid_record(const char* record, std::size_t available){
+                Header header;
+                if (available < sizeof(header))
+                    return false;
+                std::memcpy(&header, record, sizeof(header));
+                return header.type > 0 && header.bodySize >= 0
+                    && static_cast<std::size_t>(header.bodySize) <= available - sizeof(header);
+            }
+
+        private:
+            enum { magic_length = 8 };
+            enum { base_offset = 8 };
+            enum { committed_offset = 16 };
+
+            static const char* magic() { return "CHATLOG1"; }
+
+            log_segment(int fd, std::size_t capacity, std::size_t allocated)
+                : fd_(fd),
+                data_(nullptr),
+                capacity_(capacity),
+                allocated_(allocated),
+                base_seq_(0),
+                records_(0),
+                size_(header_length),
+                synced_(header_length){
+                    log_stats().segments.fetch_add(1, std::memory_order_relaxed);
+                }
+
+            bool map(){
+                void* p = mmap(nullptr, capacity_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+                if (p == MAP_FAILED)
+                    return false;
+                data_ = static_cast<char*>(p);
+                return true;
+            }
+
+            void set_committed(std::uint64_t committed){
+                std::memcpy(data_ + committed_offset, &committed, sizeof(committed));
+            }
+
+            //落盘的长度以内都是刷下去的完整记录，一条一条往后数，只检查每条没有越界；
+            //越界说明文件坏了，停在那里
+            void recover(std::size_t committed){
+                index_.emplace_back(base_seq_, static_cast<std::uint32_t>(header_length));
+                while (size_ < committed) {
+                    if (!valid_record(data_ + size_, committed - size_)) {
+                        std::cout << "message log segment " << base_seq_ << " broken at " << size_
+                            << ", committed " << committed << std::endl;
+                        break;
+                    }
+                    if (records_ % index_interval == 0 && records_ > 0)
+                        index_.emplace_back(end_seq(), static_cast<std::uint32_t>(size_));
+                    size_ += record_length(data_ + size_);
+                    ++records_;
+                }
+                synced_ = size_;
+            }
+
+            int fd_;
+            char* data_;
+            std::size_t capacity_;   //映射的大小，这一段最多写这么多
+            std::size_t allocated_;  //文件现在的大小，只有日志线程用
+            std::uint64_t base_seq_;
+            std::uint64_t records_;
+            std::size_t size_;    //已经写到哪里了，包括文件头
+            std::size_t synced_;  //已经刷到哪里了，只有日志线程用
+            std::vector<std::pair<std::uint64_t, std::uint32_t>> index_;  //稀疏索引：(序号, 偏移)
+    };
+
+    //一个序号范围在某一段里对应的那一截字节，可以按记录遍历，也可以拿段文件的fd整截发出去
+    struct log_span {
+        std::shared_ptr<log_segment> segment;
+        std::size_t offset;
+        std::size_t length;
+        std::uint64_t records;
+
+        //按顺序对每条记录调用f(帧头, body, body长度)
+        template <typename Function>
+        void for_each(Function f) const {
+            const char* p = segment->data() + offset;
+            for (std::uint64_t i = 0; i < records; ++i) {
+                Header header;
+                std::memcpy(&header, p, sizeof(header));
+                f(header, p + sizeof(header), static_cast<std::size_t>(header.bodySize));
+                p += sizeof(header) + header.bodySize;
+            }
+        }
+    };
+
+    class message_log;
+
+    //一个房间的日志，序号从1开始，一条接一条，跨段也是连续的
+    //目录里已有的段第一次用到的时候在锁里扫(load_locked)；
+    //段文件可能被日志线程关掉(closed_)，读写之前在锁里按saved_重新打开
+    class room_log : public std::enable_shared_from_this<room_log> {
+        public:
+            using clock = std::chrono::steady_clock;
+
+            room_log(message_log& writer, std::string directory, std::size_t segment_size)
+                : writer_(writer),
+                directory_(std::move(directory)),
+                segment_size_(segment_size),
+                next_seq_(1),
+                accepted_(0){
+                }
+
+            room_log(const room_log&) = delete;
+            room_log& operator=(const room_log&) = delete;
+
+            //任意线程都可以调用，只是交给日志线程，不碰磁盘
+            //同一个房间要按顺序调用(房间在自己的锁里调)，日志里的顺序就是调用的顺序
+            inline void append(const chat_frame_ptr& frame);
+
+            //房间里没人了，不用等idle_close_seconds，写的都刷完以后就把段关掉
+            inline void release();
+
+            //交给日志线程的记录都已经写进去了(写失败的不算)，这时候日志里的就是房间的全部消息
+            bool settled(){
+                std::lock_guard<std::mutex> lock(mutex_);
+                load_locked();
+                return next_seq_ - 1 == accepted_.load(std::memory_order_relaxed);
+            }
+
+            //最后一条已经写进去的记录的序号，没有的话是0
+            std::uint64_t last_seq(){
+                std::lock_guard<std::mutex> lock(mutex_);
+                load_locked();
+                return next_seq_ - 1;
+            }
+
+            //日志里最早的一条的序号，还没有记录的话是下一条的序号
+            //关着的时候不用打开，看saved_就行
+            std::uint64_t first_seq(){
+                std::lock_guard<std::mutex> lock(mutex_);
+                load_locked();
+                if (closed_)
+                    return saved_.front().base_seq;
+                return segments_.empty() ? next_seq_ : segments_.front()->base_seq();
+            }
+
+            //序号从first开始最多count条记录在哪些段的哪几截，已经写进去的才算
+            std::vector<log_span> locate(std::uint64_t first, std::size_t count){
+                std::vector<log_span> spans;
+                std::lock_guard<std::mutex> lock(mutex_);
+                open_locked();
+                if (segments_.empty())
+                    return spans;
+                first = std::max(first, segments_.front()->base_seq());
+                std::uint64_t last = std::min<std::uint64_t>(next_seq_, first + count);
+                //最后一个base_seq不大于first的段
+                auto it = std::upper_bound(segments_.begin(), segments_.end(), first,
+                        [](std::uint64_t seq, const std::shared_ptr<log_segment>& segment){
+                            return seq < segment->base_seq();
+                        });
+                if (it != segments_.begin())
+                    --it;
+                for (; it != segments_.end() && first < last; ++it) {
+                    const std::shared_ptr<log_segment>& segment = *it;
+                    std::uint64_t end = std::min(last, segment->end_seq());
+                    if (end <= first)
+                        continue;
+                    std::size_t begin = segment->offset_of(first);
+                    spans.push_back(log_span{segment, begin, segment->offset_of(end) - begin, end - first});
+                    first = end;
+                }
+                return spans;
+            }
+
+            //按顺序对每条记录调用f(帧头, body, body长度)，返回一共几条
+            template <typename Function>
+            std::size_t read(std::uint64_t first, std::size_t count, Function f){
+                std::size_t records = 0;
+                for (const log_span& span: locate(first, count)) {
+                    span.for_each(f);
+                    records += span.records;
+                }
+                return records;
+            }
+
+        private:
+            friend class message_log;
+
+            enum { name_digits = 20 };
+            enum { segment_name_length = name_digits + 4 };
+
+            //第一次用的时候打开目录里已有的段，目录还不存在就是空的，等第一条消息写进来再建
+            //已有的记录也算进accepted_，用加的，扫之前已经交进来的也还算着
+            void load_locked(){
+                if (loaded_)
+                    return;
+                loaded_ = true;
+                last_used_ = clock::now();
+                std::vector<std::uint64_t> bases;
+                if (DIR* dir = opendir(directory_.c_str())) {
+                    while (dirent* entry = readdir(dir)) {
+                        std::string name = entry->d_name;
+                        if (name.size() == segment_name_length && name.compare(name_digits, std::string::npos, ".log") == 0)
+                            bases.push_back(std::strtoull(name.c_str(), nullptr, 10));
+                    }
+                    closedir(dir);
+                }
+                std::sort(bases.begin(), bases.end());
+                for (auto it = bases.begin(); it != bases.end(); ++it) {
+                    std::shared_ptr<log_segment> segment = log_segment::open(segment_path(*it), segment_size_);
+                    //接不上的段(前面的段坏了)和它后面的都不要了，再写会从断开的地方接着写；
+                    //改名挪开，不然写到那个序号的时候新建段会把它清空
+                    if (!segment || segment->base_seq() != *it || (!segments_.empty() && *it != next_seq_)) {
+                        for (; it != bases.end(); ++it) {
+                            std::string path = segment_path(*it);
+                            std::cout << "message log " << path << " skipped, moved to " << path << ".broken" << std::endl;
+                            std::rename(path.c_str(), (path + ".broken").c_str());
+                        }
+                        break;
+                    }
+                    segments_.push_back(segment);
+                    next_seq_ = segment->end_seq();
+                }
+                accepted_.fetch_add(next_seq_ - 1, std::memory_order_relaxed);
+            }
+
+            //关掉以后第一次用的时候重新打开，关之前都刷过盘，照着saved_恢复以后和关之前一样
+            //文件被挪走了、换掉了的话这些段就当没有了，之后的消息从next_seq_开始写在新段里
+            void open_locked(){
+                load_locked();
+                last_used_ = clock::now();
+                if (!closed_)
+                    return;
+                closed_ = false;
+                for (log_segment::state& saved: saved_) {
+                    std::string path = segment_path(saved.base_seq);
+                    std::shared_ptr<log_segment> segment = log_segment::reopen(path, std::move(saved));
+                    if (!segment) {
+                        std::cout << "message log " << path << " reopen failed, drop " << directory_ << std::endl;
+                        segments_.clear();
+                        break;
+                    }
+                    segments_.push_back(std::move(segment));
+                }
+                saved_.clear();
+            }
+
+            //段文件名按序号补0，字典序就是序号的顺序
+            std::string segment_path(std::uint64_t base) const {
+                char name[segment_name_length + 1];
+                std::snprintf(name, sizeof(name), "%020llu.log", static_cast<unsigned long long>(base));
+                return directory_ + "/" + name;
+            }
+
+            //下面几个只在日志线程上调用
+
+            //写一帧，返回写进去的字节数，失败返回0
+            //段只在日志线程上打开、关掉和新建，打开以后这里在锁外面看segments_也没关系
+            std::size_t write(const chat_message& frame){
+                if (failed_)
+                    return 0;
+                std::size_t length = frame.length();
+                //写进去的恢复的时候一定要认，不然这一条后面的都丢了
+                if (!log_segment::valid_record(frame.data(), length))
+                    return fail();
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    open_locked();
+                }
+                if ((segments_.empty() || segments_.back()->space() < length) && !roll(length))
+                    return fail();
+                if (!segments_.back()->reserve(length))
+                    return fail();
+                std::lock_guard<std::mutex> lock(mutex_);
+                segments_.back()->append(frame.data(), length);
+                ++next_seq_;
+                return length;
+            }
+
+            //当前的段满了，先把它刷完，再开一个新的；新段建好之前不会有人在读它，不用拿锁
+            bool roll(std::size_t length){
+                if (!segments_.empty() && !segments_.back()->sync())
+                    return false;
+                if (segments_.empty() && !make_directories(directory_))
+                    return false;
+                std::size_t capacity = std::max<std::size_t>(segment_size_, log_segment::header_length + length);
+                std::shared_ptr<log_segment> segment = log_segment::create(segment_path(next_seq_), next_seq_, capacity);
+                if (!segment)
+                    return false;
+                std::lock_guard<std::mutex> lock(mutex_);
+                segments_.push_back(std::move(segment));
+                return true;
+            }
+
+            std::size_t fail(){
+                failed_ = true;
+                log_stats().failures.fetch_add(1, std::memory_order_relaxed);
+                std::cout << "message log " << directory_ << " failed, stop logging this room" << std::endl;
+                return 0;
+            }
+
+            bool sync(){
+                dirty_ = false;
+                //一般只有最后一段有没刷的，roll的时候前一段已经刷完了
+                return segments_.empty() || segments_.back()->sync();
+            }
+
+            //before以后没有读写过、写的都刷完了的话把段都关掉
+            void close_if_idle(clock::time_point before){
+                if (dirty_)
+                    return;
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (last_used_ <= before)
+                    close_locked();
+            }
+
+            //release以后没有新的消息进来的话关掉；release之前交进来的这时候已经写完、刷完了
+            void close_if_unchanged(std::uint64_t accepted){
+                if (dirty_ || accepted_.load(std::memory_order_relaxed) != accepted)
+                    return;
+                std::lock_guard<std::mutex> lock(mutex_);
+                close_locked();
+            }
+
+            //正在发的历史消息手里有段的shared_ptr，发完才真的close
+            void close_locked(){
+                if (closed_ || segments_.empty() || next_seq_ - 1 != accepted_.load(std::memory_order_relaxed))
+                    return;
+                for (const std::shared_ptr<log_segment>& segment: segments_)
+                    saved_.push_back(segment->save());
+                segments_.clear();
+                closed_ = true;
+            }
+
+            static bool make_directories(const std::string& path){
+                for (std::size_t pos = path.find('/', 1); ; pos = path.find('/', pos + 1)) {
+                    std::string part = path.substr(0, pos);
+                    if (mkdir(part.c_str(), 0755) != 0 && errno != EEXIST)
+                        return false;
+                    if (pos == std::string::npos)
+                        return true;
+                }
+            }
+
+            message_log& writer_;
+            const std::string directory_;
+            const std::size_t segment_size_;
+            std::mutex mutex_;  //保护segments_、saved_、next_seq_、loaded_、closed_、last_used_和段里的records_/size_/index_
+            std::vector<std::shared_ptr<log_segment>> segments_;
+            std::uint64_t next_seq_;  //下一条写进去的记录的序号
+            std::atomic<std::uint64_t> accepted_;  //已经有的加上交给日志线程的记录数
+            std::vector<log_segment::state> saved_;  //关掉的时候每一段的样子
+            bool loaded_ = false;  //目录里已有的段扫过了
+            bool closed_ = false;  //段都关掉了，next_seq_和saved_还是对的
+            clock::time_point last_used_;  //最后一次读写，日志线程按它关掉不用的日志
+            bool dirty_ = false;   //有写了还没刷的，只有日志线程用
+            bool failed_ = false;  //建段或者刷盘失败过，之后不再写，只有日志线程用
+    };
+
+    //所有房间的日志共用一个后台线程
+    class message_log {
+        public:
+            enum { min_segment_size = 64 * 1024 };
+            enum { idle_close_seconds = 10 };  //这么久没有读写的房间日志把段文件关掉
+
+            //segment_size是每个段文件的大小，攒够commit_bytes或者等了commit_interval就刷一次盘
+            message_log(std::string directory, std::size_t segment_size,
+                    std::size_t commit_bytes, std::chrono::milliseconds commit_interval)
+                : directory_(std::move(directory)),
+                segment_size_(std::max<std::size_t>(segment_size, min_segment_size)),
+                commit_bytes_(commit_bytes),
+                commit_interval_(commit_interval),
+                stopping_(false){
+                    log_stats().enabled.store(true, std::memory_order_relaxed);
+                    thread_ = std::thread([this](){ run(); });
+                }
+
+            //队列里剩下的写完、刷完再退出
+            ~message_log(){
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    stopping_ = true;
+                }
+                ready_.notify_one();
+                thread_.join();
+            }
+
+            message_log(const message_log&) = delete;
+            message_log& operator=(const message_log&) = delete;
+
+            //name是相对于日志根目录的路径，目录里已有的段等第一次用的时候再扫，这里不碰磁盘
+            //房间被清理掉以后日志可能还在日志线程手里(队列里、等着刷盘)，这时候再建同一个房间拿到的是同一个room_log，
+            //一个目录同时只有一个在写
+            std::shared_ptr<room_log> open(const std::string& name){
+                std::string path = directory_ + "/" + name;
+                std::lock_guard<std::mutex> lock(logs_mutex_);
+                std::weak_ptr<room_log>& entry = logs_[path];
+                if (auto log = entry.lock())
+                    return log;
+                auto log = std::make_shared<room_log>(*this, path, segment_size_);
+                entry = log;
+                return log;
+            }
+
+            void release(std::shared_ptr<room_log> log){
+                std::uint64_t accepted = log->accepted_.load(std::memory_order_relaxed);
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    releases_.emplace_back(std::move(log), accepted);
+                }
+                ready_.notify_one();
+            }
+
+            void enqueue(std::shared_ptr<room_log> log, const chat_frame_ptr& frame){
+                log->accepted_.fetch_add(1, std::memory_order_relaxed);
+                log_stats().pending.fetch_add(1, std::memory_order_relaxed);
+                bool wake;
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    wake = queue_.empty();
+                    queue_.emplace_back(std::move(log), frame);
+                }
+                //队列本来就不空的话日志线程已经被叫醒过了
+                if (wake)
+                    ready_.notify_one();
+            }
+
+        private:
+            using clock = std::chrono::steady_clock;
+            using entry = std::pair<std::shared_ptr<room_log>, chat_frame_ptr>;
+            using release_entry = std::pair<std::shared_ptr<room_log>, std::uint64_t>;  //release的时候的accepted_
+
+            void run(){
+                std::vector<entry> batch;
+                std::vector<release_entry> releases;  //等着关掉的，刷完盘再关
+                std::vector<std::shared_ptr<room_log>> dirty;  //这一轮写过的房间
+                std::size_t dirty_bytes = 0;
+                clock::time_point deadline;
+                const clock::duration idle = std::chrono::seconds(idle_close_seconds);
+                clock::time_point scan_at = clock::now() + idle;
+                auto has_work = [this](){ return !queue_.empty() || !releases_.empty() || stopping_; };
+                std::unique_lock<std::mutex> lock(mutex_);
+                for (;;) {
+                    ready_.wait_until(lock, dirty.empty() ? scan_at : std::min(deadline, scan_at), has_work);
+                    batch.swap(queue_);
+                    releases.insert(releases.end(), releases_.begin(), releases_.end());
+                    releases_.clear();
+                    bool stop = stopping_;
+                    lock.unlock();
+                    for (auto& e: batch) {
+                        std::size_t length = e.first->write(*e.second);
+                        if (length == 0)
+                            continue;
+                        if (dirty.empty())
+                            deadline = clock::now() + commit_interval_;
+                        if (!e.first->dirty_) {
+                            e.first->dirty_ = true;
+                            dirty.push_back(e.first);
+                        }
+                        dirty_bytes += length;
+                        log_stats().records.fetch_add(1, std::memory_order_relaxed);
+                        log_stats().bytes.fetch_add(length, std::memory_order_relaxed);
+                    }
+                    log_stats().pending.fetch_sub(static_cast<long>(batch.size()), std::memory_order_relaxed);
+                    batch.clear();
+                    if (!dirty.empty() && (stop || dirty_bytes >= commit_bytes_ || clock::now() >= deadline)) {
+                        for (auto& log: dirty) {
+                            if (!log->sync())
+                                log_stats().failures.fetch_add(1, std::memory_order_relaxed);
+                        }
+                        dirty.clear();
+                        dirty_bytes = 0;
+                        log_stats().commits.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    //刷完盘才关，要关的时候之后又有消息的不关
+                    if (dirty.empty() && !releases.empty()) {
+                        for (auto& r: releases)
+                            r.first->close_if_unchanged(r.second);
+                        releases.clear();
+                    }
+                    if (clock::now() >= scan_at) {
+                        close_idle(clock::now() - idle);
+                        scan_at = clock::now() + idle;
+                    }
+                    lock.lock();
+                    if (stop && queue_.empty())
+                        break;
+                }
+            }
+
+            //把一段时间没用过的日志关掉，顺便去掉已经没有了的
+            void close_idle(clock::time_point before){
+                std::vector<std::shared_ptr<room_log>> logs;
+                {
+                    std::lock_guard<std::mutex> lock(logs_mutex_);
+                    for (auto it = logs_.begin(); it != logs_.end(); ) {
+                        if (auto log = it->second.lock()) {
+                            logs.push_back(std::move(log));
+                            ++it;
+                        } else {
+                            it = logs_.erase(it);
+                        }
+                    }
+                }
+                for (auto& log: logs)
+                    log->close_if_idle(before);
+            }
+
+            const std::string directory_;
+            const std::size_t segment_size_;
+            const std::size_t commit_bytes_;
+            const std::chrono::milliseconds commit_interval_;
+            std::mutex mutex_;  //保护queue_、releases_和stopping_
+            std::condition_variable ready_;
+            std::vector<entry> queue_;
+            std::vector<release_entry> releases_;
+            bool stopping_;
+            std::mutex logs_mutex_;  //保护logs_
+            std::unordered_map<std::string, std::weak_ptr<room_log>> logs_;  //按目录找打开着的日志
+            std::thread thread_;
+    };
+
+    void room_log::append(const chat_frame_ptr& frame){
+        writer_.enqueue(shared_from_this(), frame);
+    }
+
+    void room_log::release(){
+        writer_.release(shared_from_this());
+    }
+}
+#endif // MESSAGE_LOG_HPP
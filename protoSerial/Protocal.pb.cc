@@ -5,363 +5,710 @@
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
-// This is a temporary google only hack
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-#include "third_party/protobuf/version.h"
-#endif
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
 namespace chat {
 namespace information {
-class PBindNameDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<PBindName>
-      _instance;
-} _PBindName_default_instance_;
-class PChatDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<PChat>
-      _instance;
-} _PChat_default_instance_;
-class PRoomInformationDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<PRoomInformation>
-      _instance;
-} _PRoomInformation_default_instance_;
-class PServerErrorMessageDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<PServerErrorMessage>
-      _instance;
-} _PServerErrorMessage_default_instance_;
+PROTOBUF_CONSTEXPR PBindName::PBindName(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PBindNameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PBindNameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PBindNameDefaultTypeInternal() {}
+  union {
+    PBindName _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PBindNameDefaultTypeInternal _PBindName_default_instance_;
+PROTOBUF_CONSTEXPR PChat::PChat(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.information_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PChatDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PChatDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PChatDefaultTypeInternal() {}
+  union {
+    PChat _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PChatDefaultTypeInternal _PChat_default_instance_;
+PROTOBUF_CONSTEXPR PRoomInformation::PRoomInformation(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.information_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.time_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PRoomInformationDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PRoomInformationDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PRoomInformationDefaultTypeInternal() {}
+  union {
+    PRoomInformation _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PRoomInformationDefaultTypeInternal _PRoomInformation_default_instance_;
+PROTOBUF_CONSTEXPR PChunk::PChunk(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/uint64_t{0u}
+  , /*decltype(_impl_.index_)*/0u
+  , /*decltype(_impl_.last_)*/false
+  , /*decltype(_impl_.time_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PChunkDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PChunkDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PChunkDefaultTypeInternal() {}
+  union {
+    PChunk _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PChunkDefaultTypeInternal _PChunk_default_instance_;
+PROTOBUF_CONSTEXPR PBatchRecord::PBatchRecord(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.information_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.time_delta_)*/int64_t{0}
+  , /*decltype(_impl_.name_index_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PBatchRecordDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PBatchRecordDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PBatchRecordDefaultTypeInternal() {}
+  union {
+    PBatchRecord _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PBatchRecordDefaultTypeInternal _PBatchRecord_default_instance_;
+PROTOBUF_CONSTEXPR PRoomBatch::PRoomBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.names_)*/{}
+  , /*decltype(_impl_.records_)*/{}
+  , /*decltype(_impl_.base_time_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PRoomBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PRoomBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PRoomBatchDefaultTypeInternal() {}
+  union {
+    PRoomBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PRoomBatchDefaultTypeInternal _PRoomBatch_default_instance_;
+PROTOBUF_CONSTEXPR PServerErrorMessage::PServerErrorMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.mes_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PServerErrorMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PServerErrorMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PServerErrorMessageDefaultTypeInternal() {}
+  union {
+    PServerErrorMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PServerErrorMessageDefaultTypeInternal _PServerErrorMessage_default_instance_;
+PROTOBUF_CONSTEXPR PHello::PHello(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.features_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PHelloDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PHelloDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PHelloDefaultTypeInternal() {}
+  union {
+    PHello _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PHelloDefaultTypeInternal _PHello_default_instance_;
+PROTOBUF_CONSTEXPR PJoinRoom::PJoinRoom(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.room_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PJoinRoomDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PJoinRoomDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PJoinRoomDefaultTypeInternal() {}
+  union {
+    PJoinRoom _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PJoinRoomDefaultTypeInternal _PJoinRoom_default_instance_;
+PROTOBUF_CONSTEXPR PLeaveRoom::PLeaveRoom(
+    ::_pbi::ConstantInitialized) {}
+struct PLeaveRoomDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PLeaveRoomDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PLeaveRoomDefaultTypeInternal() {}
+  union {
+    PLeaveRoom _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PLeaveRoomDefaultTypeInternal _PLeaveRoom_default_instance_;
+PROTOBUF_CONSTEXPR PDirectMessage::PDirectMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.to_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.from_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.information_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.time_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PDirectMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PDirectMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PDirectMessageDefaultTypeInternal() {}
+  union {
+    PDirectMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PDirectMessageDefaultTypeInternal _PDirectMessage_default_instance_;
+PROTOBUF_CONSTEXPR PPresenceQuery::PPresenceQuery(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.since_version_)*/uint64_t{0u}
+  , /*decltype(_impl_.subscription_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PPresenceQueryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PPresenceQueryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PPresenceQueryDefaultTypeInternal() {}
+  union {
+    PPresenceQuery _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PPresenceQueryDefaultTypeInternal _PPresenceQuery_default_instance_;
+PROTOBUF_CONSTEXPR PPresenceMember::PPresenceMember(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PPresenceMemberDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PPresenceMemberDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PPresenceMemberDefaultTypeInternal() {}
+  union {
+    PPresenceMember _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PPresenceMemberDefaultTypeInternal _PPresenceMember_default_instance_;
+PROTOBUF_CONSTEXPR PPresenceDelta::PPresenceDelta(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/uint64_t{0u}
+  , /*decltype(_impl_.kind_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PPresenceDeltaDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PPresenceDeltaDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PPresenceDeltaDefaultTypeInternal() {}
+  union {
+    PPresenceDelta _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PPresenceDeltaDefaultTypeInternal _PPresenceDelta_default_instance_;
+PROTOBUF_CONSTEXPR PPresence::PPresence(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.members_)*/{}
+  , /*decltype(_impl_.deltas_)*/{}
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.page_)*/0u
+  , /*decltype(_impl_.snapshot_)*/false
+  , /*decltype(_impl_.last_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PPresenceDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PPresenceDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PPresenceDefaultTypeInternal() {}
+  union {
+    PPresence _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PPresenceDefaultTypeInternal _PPresence_default_instance_;
+PROTOBUF_CONSTEXPR PHistoryQuery::PHistoryQuery(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.before_seq_)*/uint64_t{0u}
+  , /*decltype(_impl_.count_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PHistoryQueryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PHistoryQueryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PHistoryQueryDefaultTypeInternal() {}
+  union {
+    PHistoryQuery _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PHistoryQueryDefaultTypeInternal _PHistoryQuery_default_instance_;
+PROTOBUF_CONSTEXPR PHistory::PHistory(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.first_seq_)*/uint64_t{0u}
+  , /*decltype(_impl_.count_)*/0u
+  , /*decltype(_impl_.bytes_)*/0u
+  , /*decltype(_impl_.last_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PHistoryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PHistoryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PHistoryDefaultTypeInternal() {}
+  union {
+    PHistory _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PHistoryDefaultTypeInternal _PHistory_default_instance_;
 }  // namespace information
 }  // namespace chat
-namespace protobuf_Protocal_2eproto {
-static void InitDefaultsPBindName() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::chat::information::_PBindName_default_instance_;
-    new (ptr) ::chat::information::PBindName();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::chat::information::PBindName::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_PBindName =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsPBindName}, {}};
-
-static void InitDefaultsPChat() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::chat::information::_PChat_default_instance_;
-    new (ptr) ::chat::information::PChat();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::chat::information::PChat::InitAsDefaultInstance();
-}
+static ::_pb::Metadata file_level_metadata_Protocal_2eproto[17];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_Protocal_2eproto[3];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_Protocal_2eproto = nullptr;
 
-::google::protobuf::internal::SCCInfo<0> scc_info_PChat =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsPChat}, {}};
-
-static void InitDefaultsPRoomInformation() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::chat::information::_PRoomInformation_default_instance_;
-    new (ptr) ::chat::information::PRoomInformation();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::chat::information::PRoomInformation::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_PRoomInformation =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsPRoomInformation}, {}};
-
-static void InitDefaultsPServerErrorMessage() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::chat::information::_PServerErrorMessage_default_instance_;
-    new (ptr) ::chat::information::PServerErrorMessage();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::chat::information::PServerErrorMessage::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_PServerErrorMessage =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsPServerErrorMessage}, {}};
-
-void InitDefaults() {
-  ::google::protobuf::internal::InitSCC(&scc_info_PBindName.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_PChat.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_PRoomInformation.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_PServerErrorMessage.base);
-}
-
-::google::protobuf::Metadata file_level_metadata[4];
-const ::google::protobuf::EnumDescriptor* file_level_enum_descriptors[1];
-
-const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_Protocal_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PBindName, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PBindName, _impl_.name_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PChat, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PChat, _impl_.information_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PRoomInformation, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PRoomInformation, _impl_.time_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PRoomInformation, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PRoomInformation, _impl_.information_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PChunk, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PChunk, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PChunk, _impl_.index_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PChunk, _impl_.last_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PChunk, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PChunk, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PChunk, _impl_.time_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PBatchRecord, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PBatchRecord, _impl_.name_index_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PBatchRecord, _impl_.time_delta_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PBatchRecord, _impl_.information_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PRoomBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PRoomBatch, _impl_.base_time_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PRoomBatch, _impl_.names_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PRoomBatch, _impl_.records_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PServerErrorMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PServerErrorMessage, _impl_.mes_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PHello, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PHello, _impl_.features_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PJoinRoom, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PJoinRoom, _impl_.room_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PLeaveRoom, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PDirectMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PDirectMessage, _impl_.to_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PDirectMessage, _impl_.from_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PDirectMessage, _impl_.information_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PDirectMessage, _impl_.time_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PPresenceQuery, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PPresenceQuery, _impl_.since_version_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PPresenceQuery, _impl_.subscription_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PPresenceMember, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PPresenceMember, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PPresenceMember, _impl_.name_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::chat::information::PBindName, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PPresenceDelta, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::chat::information::PBindName, name_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PPresenceDelta, _impl_.kind_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PPresenceDelta, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PPresenceDelta, _impl_.name_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::chat::information::PChat, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PPresence, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::chat::information::PChat, information_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PPresence, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PPresence, _impl_.snapshot_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PPresence, _impl_.page_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PPresence, _impl_.last_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PPresence, _impl_.members_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PPresence, _impl_.deltas_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::chat::information::PRoomInformation, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PHistoryQuery, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::chat::information::PRoomInformation, time_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::chat::information::PRoomInformation, name_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::chat::information::PRoomInformation, information_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PHistoryQuery, _impl_.before_seq_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PHistoryQuery, _impl_.count_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::chat::information::PServerErrorMessage, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PHistory, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::chat::information::PServerErrorMessage, mes_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::information::PHistory, _impl_.first_seq_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PHistory, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PHistory, _impl_.bytes_),
+  PROTOBUF_FIELD_OFFSET(::chat::information::PHistory, _impl_.last_),
 };
-static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::chat::information::PBindName)},
-  { 6, -1, sizeof(::chat::information::PChat)},
-  { 12, -1, sizeof(::chat::information::PRoomInformation)},
-  { 20, -1, sizeof(::chat::information::PServerErrorMessage)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::chat::information::PBindName)},
+  { 7, -1, -1, sizeof(::chat::information::PChat)},
+  { 14, -1, -1, sizeof(::chat::information::PRoomInformation)},
+  { 23, -1, -1, sizeof(::chat::information::PChunk)},
+  { 35, -1, -1, sizeof(::chat::information::PBatchRecord)},
+  { 44, -1, -1, sizeof(::chat::information::PRoomBatch)},
+  { 53, -1, -1, sizeof(::chat::information::PServerErrorMessage)},
+  { 60, -1, -1, sizeof(::chat::information::PHello)},
+  { 67, -1, -1, sizeof(::chat::information::PJoinRoom)},
+  { 74, -1, -1, sizeof(::chat::information::PLeaveRoom)},
+  { 80, -1, -1, sizeof(::chat::information::PDirectMessage)},
+  { 90, -1, -1, sizeof(::chat::information::PPresenceQuery)},
+  { 98, -1, -1, sizeof(::chat::information::PPresenceMember)},
+  { 106, -1, -1, sizeof(::chat::information::PPresenceDelta)},
+  { 115, -1, -1, sizeof(::chat::information::PPresence)},
+  { 127, -1, -1, sizeof(::chat::information::PHistoryQuery)},
+  { 135, -1, -1, sizeof(::chat::information::PHistory)},
 };
 
-static ::google::protobuf::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::google::protobuf::Message*>(&::chat::information::_PBindName_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::chat::information::_PChat_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::chat::information::_PRoomInformation_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::chat::information::_PServerErrorMessage_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::chat::information::_PBindName_default_instance_._instance,
+  &::chat::information::_PChat_default_instance_._instance,
+  &::chat::information::_PRoomInformation_default_instance_._instance,
+  &::chat::information::_PChunk_default_instance_._instance,
+  &::chat::information::_PBatchRecord_default_instance_._instance,
+  &::chat::information::_PRoomBatch_default_instance_._instance,
+  &::chat::information::_PServerErrorMessage_default_instance_._instance,
+  &::chat::information::_PHello_default_instance_._instance,
+  &::chat::information::_PJoinRoom_default_instance_._instance,
+  &::chat::information::_PLeaveRoom_default_instance_._instance,
+  &::chat::information::_PDirectMessage_default_instance_._instance,
+  &::chat::information::_PPresenceQuery_default_instance_._instance,
+  &::chat::information::_PPresenceMember_default_instance_._instance,
+  &::chat::information::_PPresenceDelta_default_instance_._instance,
+  &::chat::information::_PPresence_default_instance_._instance,
+  &::chat::information::_PHistoryQuery_default_instance_._instance,
+  &::chat::information::_PHistory_default_instance_._instance,
 };
 
-void protobuf_AssignDescriptors() {
-  AddDescriptors();
-  AssignDescriptors(
-      "Protocal.proto", schemas, file_default_instances, TableStruct::offsets,
-      file_level_metadata, file_level_enum_descriptors, NULL);
-}
-
-void protobuf_AssignDescriptorsOnce() {
-  static ::google::protobuf::internal::once_flag once;
-  ::google::protobuf::internal::call_once(once, protobuf_AssignDescriptors);
+const char descriptor_table_protodef_Protocal_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\016Protocal.proto\022\020chat.information\"\031\n\tPB"
+  "indName\022\014\n\004name\030\001 \001(\014\"\034\n\005PChat\022\023\n\013inform"
+  "ation\030\001 \001(\014\"C\n\020PRoomInformation\022\014\n\004time\030"
+  "\001 \001(\003\022\014\n\004name\030\002 \001(\014\022\023\n\013information\030\003 \001(\014"
+  "\"[\n\006PChunk\022\n\n\002id\030\001 \001(\004\022\r\n\005index\030\002 \001(\r\022\014\n"
+  "\004last\030\003 \001(\010\022\014\n\004data\030\004 \001(\014\022\014\n\004name\030\005 \001(\014\022"
+  "\014\n\004time\030\006 \001(\003\"K\n\014PBatchRecord\022\022\n\nname_in"
+  "dex\030\001 \001(\r\022\022\n\ntime_delta\030\002 \001(\022\022\023\n\013informa"
+  "tion\030\003 \001(\014\"_\n\nPRoomBatch\022\021\n\tbase_time\030\001 "
+  "\001(\003\022\r\n\005names\030\002 \003(\014\022/\n\007records\030\003 \003(\0132\036.ch"
+  "at.information.PBatchRecord\"\211\001\n\023PServerE"
+  "rrorMessage\022\?\n\003mes\030\001 \001(\01622.chat.informat"
+  "ion.PServerErrorMessage.ErrorMessage\"1\n\014"
+  "ErrorMessage\022\017\n\013BodyTooLong\020\000\022\020\n\014UserNot"
+  "Found\020\001\"\032\n\006PHello\022\020\n\010features\030\001 \001(\r\"\031\n\tP"
+  "JoinRoom\022\014\n\004room\030\001 \001(\014\"\014\n\nPLeaveRoom\"M\n\016"
+  "PDirectMessage\022\n\n\002to\030\001 \001(\014\022\014\n\004from\030\002 \001(\014"
+  "\022\023\n\013information\030\003 \001(\014\022\014\n\004time\030\004 \001(\003\"\246\001\n\016"
+  "PPresenceQuery\022\025\n\rsince_version\030\001 \001(\004\022C\n"
+  "\014subscription\030\002 \001(\0162-.chat.information.P"
+  "PresenceQuery.Subscription\"8\n\014Subscripti"
+  "on\022\010\n\004KEEP\020\000\022\r\n\tSUBSCRIBE\020\001\022\017\n\013UNSUBSCRI"
+  "BE\020\002\"+\n\017PPresenceMember\022\n\n\002id\030\001 \001(\004\022\014\n\004n"
+  "ame\030\002 \001(\014\"\210\001\n\016PPresenceDelta\0223\n\004kind\030\001 \001"
+  "(\0162%.chat.information.PPresenceDelta.Kin"
+  "d\022\n\n\002id\030\002 \001(\004\022\014\n\004name\030\003 \001(\014\"\'\n\004Kind\022\010\n\004J"
+  "OIN\020\000\022\t\n\005LEAVE\020\001\022\n\n\006RENAME\020\002\"\260\001\n\tPPresen"
+  "ce\022\017\n\007version\030\001 \001(\004\022\020\n\010snapshot\030\002 \001(\010\022\014\n"
+  "\004page\030\003 \001(\r\022\014\n\004last\030\004 \001(\010\0222\n\007members\030\005 \003"
+  "(\0132!.chat.information.PPresenceMember\0220\n"
+  "\006deltas\030\006 \003(\0132 .chat.information.PPresen"
+  "ceDelta\"2\n\rPHistoryQuery\022\022\n\nbefore_seq\030\001"
+  " \001(\004\022\r\n\005count\030\002 \001(\r\"I\n\010PHistory\022\021\n\tfirst"
+  "_seq\030\001 \001(\004\022\r\n\005count\030\002 \001(\r\022\r\n\005bytes\030\003 \001(\r"
+  "\022\014\n\004last\030\004 \001(\010B\003\370\001\001b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_Protocal_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_Protocal_2eproto = {
+    false, false, 1387, descriptor_table_protodef_Protocal_2eproto,
+    "Protocal.proto",
+    &descriptor_table_Protocal_2eproto_once, nullptr, 0, 17,
+    schemas, file_default_instances, TableStruct_Protocal_2eproto::offsets,
+    file_level_metadata_Protocal_2eproto, file_level_enum_descriptors_Protocal_2eproto,
+    file_level_service_descriptors_Protocal_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_Protocal_2eproto_getter() {
+  return &descriptor_table_Protocal_2eproto;
 }
 
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 4);
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_Protocal_2eproto(&descriptor_table_Protocal_2eproto);
+namespace chat {
+namespace information {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PServerErrorMessage_ErrorMessage_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_Protocal_2eproto);
+  return file_level_enum_descriptors_Protocal_2eproto[0];
 }
-
-void AddDescriptorsImpl() {
-  InitDefaults();
-  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-      "\n\016Protocal.proto\022\020chat.information\"\031\n\tPB"
-      "indName\022\014\n\004name\030\001 \001(\014\"\034\n\005PChat\022\023\n\013inform"
-      "ation\030\001 \001(\014\"C\n\020PRoomInformation\022\014\n\004time\030"
-      "\001 \001(\003\022\014\n\004name\030\002 \001(\014\022\023\n\013information\030\003 \001(\014"
-      "\"w\n\023PServerErrorMessage\022\?\n\003mes\030\001 \001(\01622.c"
-      "hat.information.PServerErrorMessage.Erro"
-      "rMessage\"\037\n\014ErrorMessage\022\017\n\013BodyTooLong\020"
-      "\000b\006proto3"
-  };
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 289);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "Protocal.proto", &protobuf_RegisterTypes);
+bool PServerErrorMessage_ErrorMessage_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
 }
 
-void AddDescriptors() {
-  static ::google::protobuf::internal::once_flag once;
-  ::google::protobuf::internal::call_once(once, AddDescriptorsImpl);
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr PServerErrorMessage_ErrorMessage PServerErrorMessage::BodyTooLong;
+constexpr PServerErrorMessage_ErrorMessage PServerErrorMessage::UserNotFound;
+constexpr PServerErrorMessage_ErrorMessage PServerErrorMessage::ErrorMessage_MIN;
+constexpr PServerErrorMessage_ErrorMessage PServerErrorMessage::ErrorMessage_MAX;
+constexpr int PServerErrorMessage::ErrorMessage_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PPresenceQuery_Subscription_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_Protocal_2eproto);
+  return file_level_enum_descriptors_Protocal_2eproto[1];
 }
-// Force AddDescriptors() to be called at dynamic initialization time.
-struct StaticDescriptorInitializer {
-  StaticDescriptorInitializer() {
-    AddDescriptors();
+bool PPresenceQuery_Subscription_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
   }
-} static_descriptor_initializer;
-}  // namespace protobuf_Protocal_2eproto
-namespace chat {
-namespace information {
-const ::google::protobuf::EnumDescriptor* PServerErrorMessage_ErrorMessage_descriptor() {
-  protobuf_Protocal_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Protocal_2eproto::file_level_enum_descriptors[0];
 }
-bool PServerErrorMessage_ErrorMessage_IsValid(int value) {
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr PPresenceQuery_Subscription PPresenceQuery::KEEP;
+constexpr PPresenceQuery_Subscription PPresenceQuery::SUBSCRIBE;
+constexpr PPresenceQuery_Subscription PPresenceQuery::UNSUBSCRIBE;
+constexpr PPresenceQuery_Subscription PPresenceQuery::Subscription_MIN;
+constexpr PPresenceQuery_Subscription PPresenceQuery::Subscription_MAX;
+constexpr int PPresenceQuery::Subscription_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PPresenceDelta_Kind_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_Protocal_2eproto);
+  return file_level_enum_descriptors_Protocal_2eproto[2];
+}
+bool PPresenceDelta_Kind_IsValid(int value) {
   switch (value) {
     case 0:
+    case 1:
+    case 2:
       return true;
     default:
       return false;
   }
 }
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const PServerErrorMessage_ErrorMessage PServerErrorMessage::BodyTooLong;
-const PServerErrorMessage_ErrorMessage PServerErrorMessage::ErrorMessage_MIN;
-const PServerErrorMessage_ErrorMessage PServerErrorMessage::ErrorMessage_MAX;
-const int PServerErrorMessage::ErrorMessage_ARRAYSIZE;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr PPresenceDelta_Kind PPresenceDelta::JOIN;
+constexpr PPresenceDelta_Kind PPresenceDelta::LEAVE;
+constexpr PPresenceDelta_Kind PPresenceDelta::RENAME;
+constexpr PPresenceDelta_Kind PPresenceDelta::Kind_MIN;
+constexpr PPresenceDelta_Kind PPresenceDelta::Kind_MAX;
+constexpr int PPresenceDelta::Kind_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
 // ===================================================================
 
-void PBindName::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PBindName::kNameFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PBindName::_Internal {
+ public:
+};
 
-PBindName::PBindName()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_Protocal_2eproto::scc_info_PBindName.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:chat.information.PBindName)
+PBindName::PBindName(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.information.PBindName)
 }
 PBindName::PBindName(const PBindName& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PBindName* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:chat.information.PBindName)
 }
 
-void PBindName::SharedCtor() {
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PBindName::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PBindName::~PBindName() {
   // @@protoc_insertion_point(destructor:chat.information.PBindName)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PBindName::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PBindName::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
 }
 
 void PBindName::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* PBindName::descriptor() {
-  ::protobuf_Protocal_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_Protocal_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const PBindName& PBindName::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_Protocal_2eproto::scc_info_PBindName.base);
-  return *internal_default_instance();
-}
-
-
 void PBindName::Clear() {
 // @@protoc_insertion_point(message_clear_start:chat.information.PBindName)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
+  _impl_.name_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool PBindName::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:chat.information.PBindName)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* PBindName::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bytes name = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_name()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:chat.information.PBindName)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:chat.information.PBindName)
-  return false;
-#undef DO_
-}
-
-void PBindName::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:chat.information.PBindName)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // bytes name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      1, this->name(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:chat.information.PBindName)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PBindName::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PBindName::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:chat.information.PBindName)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes name = 1;
-  if (this->name().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        1, this->name(), target);
+  if (!this->_internal_name().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:chat.information.PBindName)
   return target;
@@ -371,56 +718,39 @@ size_t PBindName::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:chat.information.PBindName)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // bytes name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_name());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PBindName::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:chat.information.PBindName)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PBindName* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PBindName>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:chat.information.PBindName)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:chat.information.PBindName)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PBindName::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PBindName::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PBindName::GetClassData() const { return &_class_data_; }
 
-void PBindName::MergeFrom(const PBindName& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:chat.information.PBindName)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.name().size() > 0) {
+void PBindName::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PBindName*>(&to_msg);
+  auto& from = static_cast<const PBindName&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.information.PBindName)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-}
-
-void PBindName::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:chat.information.PBindName)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PBindName::CopyFrom(const PBindName& from) {
@@ -434,164 +764,149 @@ bool PBindName::IsInitialized() const {
   return true;
 }
 
-void PBindName::Swap(PBindName* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PBindName::InternalSwap(PBindName* other) {
   using std::swap;
-  name_.Swap(&other->name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
 }
 
-::google::protobuf::Metadata PBindName::GetMetadata() const {
-  protobuf_Protocal_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_Protocal_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata PBindName::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Protocal_2eproto_getter, &descriptor_table_Protocal_2eproto_once,
+      file_level_metadata_Protocal_2eproto[0]);
 }
 
-
 // ===================================================================
 
-void PChat::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PChat::kInformationFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PChat::_Internal {
+ public:
+};
 
-PChat::PChat()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_Protocal_2eproto::scc_info_PChat.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:chat.information.PChat)
+PChat::PChat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.information.PChat)
 }
 PChat::PChat(const PChat& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  information_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.information().size() > 0) {
-    information_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.information_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PChat* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.information_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.information_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.information_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_information().empty()) {
+    _this->_impl_.information_.Set(from._internal_information(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:chat.information.PChat)
 }
 
-void PChat::SharedCtor() {
-  information_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PChat::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.information_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.information_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.information_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PChat::~PChat() {
   // @@protoc_insertion_point(destructor:chat.information.PChat)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PChat::SharedDtor() {
-  information_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PChat::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.information_.Destroy();
 }
 
 void PChat::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* PChat::descriptor() {
-  ::protobuf_Protocal_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_Protocal_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const PChat& PChat::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_Protocal_2eproto::scc_info_PChat.base);
-  return *internal_default_instance();
-}
-
-
 void PChat::Clear() {
 // @@protoc_insertion_point(message_clear_start:chat.information.PChat)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  information_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
+  _impl_.information_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool PChat::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:chat.information.PChat)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* PChat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bytes information = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_information()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_information();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:chat.information.PChat)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:chat.information.PChat)
-  return false;
-#undef DO_
-}
-
-void PChat::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:chat.information.PChat)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // bytes information = 1;
-  if (this->information().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      1, this->information(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:chat.information.PChat)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PChat::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PChat::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:chat.information.PChat)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes information = 1;
-  if (this->information().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        1, this->information(), target);
+  if (!this->_internal_information().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_information(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:chat.information.PChat)
   return target;
@@ -601,56 +916,39 @@ size_t PChat::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:chat.information.PChat)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // bytes information = 1;
-  if (this->information().size() > 0) {
+  if (!this->_internal_information().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->information());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_information());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PChat::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:chat.information.PChat)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PChat* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PChat>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:chat.information.PChat)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:chat.information.PChat)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PChat::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PChat::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PChat::GetClassData() const { return &_class_data_; }
 
-void PChat::MergeFrom(const PChat& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:chat.information.PChat)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.information().size() > 0) {
+void PChat::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PChat*>(&to_msg);
+  auto& from = static_cast<const PChat&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.information.PChat)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    information_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.information_);
+  if (!from._internal_information().empty()) {
+    _this->_internal_set_information(from._internal_information());
   }
-}
-
-void PChat::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:chat.information.PChat)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PChat::CopyFrom(const PChat& from) {
@@ -664,225 +962,198 @@ bool PChat::IsInitialized() const {
   return true;
 }
 
-void PChat::Swap(PChat* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PChat::InternalSwap(PChat* other) {
   using std::swap;
-  information_.Swap(&other->information_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.information_, lhs_arena,
+      &other->_impl_.information_, rhs_arena
+  );
 }
 
-::google::protobuf::Metadata PChat::GetMetadata() const {
-  protobuf_Protocal_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_Protocal_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata PChat::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Protocal_2eproto_getter, &descriptor_table_Protocal_2eproto_once,
+      file_level_metadata_Protocal_2eproto[1]);
 }
 
-
 // ===================================================================
 
-void PRoomInformation::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PRoomInformation::kTimeFieldNumber;
-const int PRoomInformation::kNameFieldNumber;
-const int PRoomInformation::kInformationFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PRoomInformation::_Internal {
+ public:
+};
 
-PRoomInformation::PRoomInformation()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_Protocal_2eproto::scc_info_PRoomInformation.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:chat.information.PRoomInformation)
+PRoomInformation::PRoomInformation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.information.PRoomInformation)
 }
 PRoomInformation::PRoomInformation(const PRoomInformation& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-  information_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.information().size() > 0) {
-    information_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.information_);
-  }
-  time_ = from.time_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PRoomInformation* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.information_){}
+    , decltype(_impl_.time_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.information_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.information_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_information().empty()) {
+    _this->_impl_.information_.Set(from._internal_information(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.time_ = from._impl_.time_;
   // @@protoc_insertion_point(copy_constructor:chat.information.PRoomInformation)
 }
 
-void PRoomInformation::SharedCtor() {
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  information_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  time_ = GOOGLE_LONGLONG(0);
+inline void PRoomInformation::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.information_){}
+    , decltype(_impl_.time_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.information_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.information_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PRoomInformation::~PRoomInformation() {
   // @@protoc_insertion_point(destructor:chat.information.PRoomInformation)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PRoomInformation::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  information_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PRoomInformation::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.information_.Destroy();
 }
 
 void PRoomInformation::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* PRoomInformation::descriptor() {
-  ::protobuf_Protocal_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_Protocal_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const PRoomInformation& PRoomInformation::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_Protocal_2eproto::scc_info_PRoomInformation.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void PRoomInformation::Clear() {
 // @@protoc_insertion_point(message_clear_start:chat.information.PRoomInformation)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  information_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  time_ = GOOGLE_LONGLONG(0);
-  _internal_metadata_.Clear();
+  _impl_.name_.ClearToEmpty();
+  _impl_.information_.ClearToEmpty();
+  _impl_.time_ = int64_t{0};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool PRoomInformation::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:chat.information.PRoomInformation)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* PRoomInformation::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // int64 time = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &time_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bytes name = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_name()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bytes information = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_information()));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_information();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:chat.information.PRoomInformation)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:chat.information.PRoomInformation)
-  return false;
-#undef DO_
-}
-
-void PRoomInformation::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:chat.information.PRoomInformation)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // int64 time = 1;
-  if (this->time() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(1, this->time(), output);
-  }
-
-  // bytes name = 2;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      2, this->name(), output);
-  }
-
-  // bytes information = 3;
-  if (this->information().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      3, this->information(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:chat.information.PRoomInformation)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* PRoomInformation::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* PRoomInformation::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:chat.information.PRoomInformation)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int64 time = 1;
-  if (this->time() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(1, this->time(), target);
+  if (this->_internal_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_time(), target);
   }
 
   // bytes name = 2;
-  if (this->name().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        2, this->name(), target);
+  if (!this->_internal_name().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_name(), target);
   }
 
   // bytes information = 3;
-  if (this->information().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        3, this->information(), target);
+  if (!this->_internal_information().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_information(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:chat.information.PRoomInformation)
   return target;
@@ -892,77 +1163,57 @@ size_t PRoomInformation::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:chat.information.PRoomInformation)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // bytes name = 2;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_name());
   }
 
   // bytes information = 3;
-  if (this->information().size() > 0) {
+  if (!this->_internal_information().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->information());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_information());
   }
 
   // int64 time = 1;
-  if (this->time() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->time());
+  if (this->_internal_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_time());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PRoomInformation::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:chat.information.PRoomInformation)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PRoomInformation* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PRoomInformation>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:chat.information.PRoomInformation)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:chat.information.PRoomInformation)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PRoomInformation::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PRoomInformation::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PRoomInformation::GetClassData() const { return &_class_data_; }
 
-void PRoomInformation::MergeFrom(const PRoomInformation& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:chat.information.PRoomInformation)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.name().size() > 0) {
+void PRoomInformation::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PRoomInformation*>(&to_msg);
+  auto& from = static_cast<const PRoomInformation&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.information.PRoomInformation)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.information().size() > 0) {
-
-    information_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.information_);
+  if (!from._internal_information().empty()) {
+    _this->_internal_set_information(from._internal_information());
   }
-  if (from.time() != 0) {
-    set_time(from.time());
+  if (from._internal_time() != 0) {
+    _this->_internal_set_time(from._internal_time());
   }
-}
-
-void PRoomInformation::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:chat.information.PRoomInformation)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PRoomInformation::CopyFrom(const PRoomInformation& from) {
@@ -976,269 +1227,3365 @@ bool PRoomInformation::IsInitialized() const {
   return true;
 }
 
-void PRoomInformation::Swap(PRoomInformation* other) {
-  if (other == this) return;
-  InternalSwap(other);
+void PRoomInformation::InternalSwap(PRoomInformation* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.information_, lhs_arena,
+      &other->_impl_.information_, rhs_arena
+  );
+  swap(_impl_.time_, other->_impl_.time_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PRoomInformation::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Protocal_2eproto_getter, &descriptor_table_Protocal_2eproto_once,
+      file_level_metadata_Protocal_2eproto[2]);
+}
+
+// ===================================================================
+
+class PChunk::_Internal {
+ public:
+};
+
+PChunk::PChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.information.PChunk)
+}
+PChunk::PChunk(const PChunk& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PChunk* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.index_){}
+    , decltype(_impl_.last_){}
+    , decltype(_impl_.time_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.time_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.time_));
+  // @@protoc_insertion_point(copy_constructor:chat.information.PChunk)
+}
+
+inline void PChunk::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.id_){uint64_t{0u}}
+    , decltype(_impl_.index_){0u}
+    , decltype(_impl_.last_){false}
+    , decltype(_impl_.time_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PChunk::~PChunk() {
+  // @@protoc_insertion_point(destructor:chat.information.PChunk)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PChunk::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
+  _impl_.name_.Destroy();
+}
+
+void PChunk::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PChunk::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.information.PChunk)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.data_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.time_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.time_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PChunk::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 index = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool last = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.last_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes data = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes name = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 time = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PChunk::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.information.PChunk)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_id(), target);
+  }
+
+  // uint32 index = 2;
+  if (this->_internal_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_index(), target);
+  }
+
+  // bool last = 3;
+  if (this->_internal_last() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_last(), target);
+  }
+
+  // bytes data = 4;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_data(), target);
+  }
+
+  // bytes name = 5;
+  if (!this->_internal_name().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_name(), target);
+  }
+
+  // int64 time = 6;
+  if (this->_internal_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_time(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.information.PChunk)
+  return target;
+}
+
+size_t PChunk::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.information.PChunk)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes data = 4;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+
+  // bytes name = 5;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_name());
+  }
+
+  // uint64 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_id());
+  }
+
+  // uint32 index = 2;
+  if (this->_internal_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_index());
+  }
+
+  // bool last = 3;
+  if (this->_internal_last() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // int64 time = 6;
+  if (this->_internal_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_time());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PChunk::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PChunk::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PChunk::GetClassData() const { return &_class_data_; }
+
+
+void PChunk::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PChunk*>(&to_msg);
+  auto& from = static_cast<const PChunk&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.information.PChunk)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_index() != 0) {
+    _this->_internal_set_index(from._internal_index());
+  }
+  if (from._internal_last() != 0) {
+    _this->_internal_set_last(from._internal_last());
+  }
+  if (from._internal_time() != 0) {
+    _this->_internal_set_time(from._internal_time());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PChunk::CopyFrom(const PChunk& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.information.PChunk)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PChunk::IsInitialized() const {
+  return true;
+}
+
+void PChunk::InternalSwap(PChunk* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PChunk, _impl_.time_)
+      + sizeof(PChunk::_impl_.time_)
+      - PROTOBUF_FIELD_OFFSET(PChunk, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PChunk::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Protocal_2eproto_getter, &descriptor_table_Protocal_2eproto_once,
+      file_level_metadata_Protocal_2eproto[3]);
+}
+
+// ===================================================================
+
+class PBatchRecord::_Internal {
+ public:
+};
+
+PBatchRecord::PBatchRecord(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.information.PBatchRecord)
+}
+PBatchRecord::PBatchRecord(const PBatchRecord& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PBatchRecord* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.information_){}
+    , decltype(_impl_.time_delta_){}
+    , decltype(_impl_.name_index_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.information_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.information_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_information().empty()) {
+    _this->_impl_.information_.Set(from._internal_information(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.time_delta_, &from._impl_.time_delta_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.name_index_) -
+    reinterpret_cast<char*>(&_impl_.time_delta_)) + sizeof(_impl_.name_index_));
+  // @@protoc_insertion_point(copy_constructor:chat.information.PBatchRecord)
+}
+
+inline void PBatchRecord::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.information_){}
+    , decltype(_impl_.time_delta_){int64_t{0}}
+    , decltype(_impl_.name_index_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.information_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.information_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PBatchRecord::~PBatchRecord() {
+  // @@protoc_insertion_point(destructor:chat.information.PBatchRecord)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PBatchRecord::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.information_.Destroy();
+}
+
+void PBatchRecord::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PBatchRecord::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.information.PBatchRecord)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.information_.ClearToEmpty();
+  ::memset(&_impl_.time_delta_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.name_index_) -
+      reinterpret_cast<char*>(&_impl_.time_delta_)) + sizeof(_impl_.name_index_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PBatchRecord::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 name_index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.name_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // sint64 time_delta = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.time_delta_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes information = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_information();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PBatchRecord::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.information.PBatchRecord)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 name_index = 1;
+  if (this->_internal_name_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_name_index(), target);
+  }
+
+  // sint64 time_delta = 2;
+  if (this->_internal_time_delta() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt64ToArray(2, this->_internal_time_delta(), target);
+  }
+
+  // bytes information = 3;
+  if (!this->_internal_information().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_information(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.information.PBatchRecord)
+  return target;
+}
+
+size_t PBatchRecord::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.information.PBatchRecord)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes information = 3;
+  if (!this->_internal_information().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_information());
+  }
+
+  // sint64 time_delta = 2;
+  if (this->_internal_time_delta() != 0) {
+    total_size += ::_pbi::WireFormatLite::SInt64SizePlusOne(this->_internal_time_delta());
+  }
+
+  // uint32 name_index = 1;
+  if (this->_internal_name_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_name_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PBatchRecord::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PBatchRecord::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PBatchRecord::GetClassData() const { return &_class_data_; }
+
+
+void PBatchRecord::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PBatchRecord*>(&to_msg);
+  auto& from = static_cast<const PBatchRecord&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.information.PBatchRecord)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_information().empty()) {
+    _this->_internal_set_information(from._internal_information());
+  }
+  if (from._internal_time_delta() != 0) {
+    _this->_internal_set_time_delta(from._internal_time_delta());
+  }
+  if (from._internal_name_index() != 0) {
+    _this->_internal_set_name_index(from._internal_name_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PBatchRecord::CopyFrom(const PBatchRecord& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.information.PBatchRecord)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PBatchRecord::IsInitialized() const {
+  return true;
+}
+
+void PBatchRecord::InternalSwap(PBatchRecord* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.information_, lhs_arena,
+      &other->_impl_.information_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PBatchRecord, _impl_.name_index_)
+      + sizeof(PBatchRecord::_impl_.name_index_)
+      - PROTOBUF_FIELD_OFFSET(PBatchRecord, _impl_.time_delta_)>(
+          reinterpret_cast<char*>(&_impl_.time_delta_),
+          reinterpret_cast<char*>(&other->_impl_.time_delta_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PBatchRecord::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Protocal_2eproto_getter, &descriptor_table_Protocal_2eproto_once,
+      file_level_metadata_Protocal_2eproto[4]);
+}
+
+// ===================================================================
+
+class PRoomBatch::_Internal {
+ public:
+};
+
+PRoomBatch::PRoomBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.information.PRoomBatch)
+}
+PRoomBatch::PRoomBatch(const PRoomBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PRoomBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.names_){from._impl_.names_}
+    , decltype(_impl_.records_){from._impl_.records_}
+    , decltype(_impl_.base_time_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.base_time_ = from._impl_.base_time_;
+  // @@protoc_insertion_point(copy_constructor:chat.information.PRoomBatch)
+}
+
+inline void PRoomBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.names_){arena}
+    , decltype(_impl_.records_){arena}
+    , decltype(_impl_.base_time_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PRoomBatch::~PRoomBatch() {
+  // @@protoc_insertion_point(destructor:chat.information.PRoomBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PRoomBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.names_.~RepeatedPtrField();
+  _impl_.records_.~RepeatedPtrField();
+}
+
+void PRoomBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PRoomBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.information.PRoomBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.names_.Clear();
+  _impl_.records_.Clear();
+  _impl_.base_time_ = int64_t{0};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PRoomBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 base_time = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.base_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes names = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_names();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.information.PBatchRecord records = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_records(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PRoomBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.information.PRoomBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 base_time = 1;
+  if (this->_internal_base_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_base_time(), target);
+  }
+
+  // repeated bytes names = 2;
+  for (int i = 0, n = this->_internal_names_size(); i < n; i++) {
+    const auto& s = this->_internal_names(i);
+    target = stream->WriteBytes(2, s, target);
+  }
+
+  // repeated .chat.information.PBatchRecord records = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_records_size()); i < n; i++) {
+    const auto& repfield = this->_internal_records(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.information.PRoomBatch)
+  return target;
+}
+
+size_t PRoomBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.information.PRoomBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes names = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.names_.size());
+  for (int i = 0, n = _impl_.names_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.names_.Get(i));
+  }
+
+  // repeated .chat.information.PBatchRecord records = 3;
+  total_size += 1UL * this->_internal_records_size();
+  for (const auto& msg : this->_impl_.records_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // int64 base_time = 1;
+  if (this->_internal_base_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_base_time());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PRoomBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PRoomBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PRoomBatch::GetClassData() const { return &_class_data_; }
+
+
+void PRoomBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PRoomBatch*>(&to_msg);
+  auto& from = static_cast<const PRoomBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.information.PRoomBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.names_.MergeFrom(from._impl_.names_);
+  _this->_impl_.records_.MergeFrom(from._impl_.records_);
+  if (from._internal_base_time() != 0) {
+    _this->_internal_set_base_time(from._internal_base_time());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PRoomBatch::CopyFrom(const PRoomBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.information.PRoomBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PRoomBatch::IsInitialized() const {
+  return true;
+}
+
+void PRoomBatch::InternalSwap(PRoomBatch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.names_.InternalSwap(&other->_impl_.names_);
+  _impl_.records_.InternalSwap(&other->_impl_.records_);
+  swap(_impl_.base_time_, other->_impl_.base_time_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PRoomBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Protocal_2eproto_getter, &descriptor_table_Protocal_2eproto_once,
+      file_level_metadata_Protocal_2eproto[5]);
+}
+
+// ===================================================================
+
+class PServerErrorMessage::_Internal {
+ public:
+};
+
+PServerErrorMessage::PServerErrorMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.information.PServerErrorMessage)
+}
+PServerErrorMessage::PServerErrorMessage(const PServerErrorMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PServerErrorMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mes_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.mes_ = from._impl_.mes_;
+  // @@protoc_insertion_point(copy_constructor:chat.information.PServerErrorMessage)
+}
+
+inline void PServerErrorMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mes_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PServerErrorMessage::~PServerErrorMessage() {
+  // @@protoc_insertion_point(destructor:chat.information.PServerErrorMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PServerErrorMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PServerErrorMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PServerErrorMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.information.PServerErrorMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.mes_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PServerErrorMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .chat.information.PServerErrorMessage.ErrorMessage mes = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_mes(static_cast<::chat::information::PServerErrorMessage_ErrorMessage>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PServerErrorMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.information.PServerErrorMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .chat.information.PServerErrorMessage.ErrorMessage mes = 1;
+  if (this->_internal_mes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_mes(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.information.PServerErrorMessage)
+  return target;
+}
+
+size_t PServerErrorMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.information.PServerErrorMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .chat.information.PServerErrorMessage.ErrorMessage mes = 1;
+  if (this->_internal_mes() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_mes());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PServerErrorMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PServerErrorMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PServerErrorMessage::GetClassData() const { return &_class_data_; }
+
+
+void PServerErrorMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PServerErrorMessage*>(&to_msg);
+  auto& from = static_cast<const PServerErrorMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.information.PServerErrorMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_mes() != 0) {
+    _this->_internal_set_mes(from._internal_mes());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PServerErrorMessage::CopyFrom(const PServerErrorMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.information.PServerErrorMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PServerErrorMessage::IsInitialized() const {
+  return true;
+}
+
+void PServerErrorMessage::InternalSwap(PServerErrorMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.mes_, other->_impl_.mes_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PServerErrorMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Protocal_2eproto_getter, &descriptor_table_Protocal_2eproto_once,
+      file_level_metadata_Protocal_2eproto[6]);
+}
+
+// ===================================================================
+
+class PHello::_Internal {
+ public:
+};
+
+PHello::PHello(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.information.PHello)
+}
+PHello::PHello(const PHello& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PHello* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.features_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.features_ = from._impl_.features_;
+  // @@protoc_insertion_point(copy_constructor:chat.information.PHello)
+}
+
+inline void PHello::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.features_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PHello::~PHello() {
+  // @@protoc_insertion_point(destructor:chat.information.PHello)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PHello::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PHello::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PHello::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.information.PHello)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.features_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PHello::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 features = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.features_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PHello::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.information.PHello)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 features = 1;
+  if (this->_internal_features() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_features(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.information.PHello)
+  return target;
+}
+
+size_t PHello::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.information.PHello)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 features = 1;
+  if (this->_internal_features() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_features());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PHello::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PHello::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PHello::GetClassData() const { return &_class_data_; }
+
+
+void PHello::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PHello*>(&to_msg);
+  auto& from = static_cast<const PHello&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.information.PHello)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_features() != 0) {
+    _this->_internal_set_features(from._internal_features());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PHello::CopyFrom(const PHello& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.information.PHello)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PHello::IsInitialized() const {
+  return true;
+}
+
+void PHello::InternalSwap(PHello* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.features_, other->_impl_.features_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PHello::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Protocal_2eproto_getter, &descriptor_table_Protocal_2eproto_once,
+      file_level_metadata_Protocal_2eproto[7]);
+}
+
+// ===================================================================
+
+class PJoinRoom::_Internal {
+ public:
+};
+
+PJoinRoom::PJoinRoom(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.information.PJoinRoom)
+}
+PJoinRoom::PJoinRoom(const PJoinRoom& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PJoinRoom* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.room_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.room_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.room_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_room().empty()) {
+    _this->_impl_.room_.Set(from._internal_room(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:chat.information.PJoinRoom)
+}
+
+inline void PJoinRoom::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.room_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.room_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.room_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PJoinRoom::~PJoinRoom() {
+  // @@protoc_insertion_point(destructor:chat.information.PJoinRoom)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PJoinRoom::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.room_.Destroy();
+}
+
+void PJoinRoom::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PJoinRoom::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.information.PJoinRoom)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.room_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PJoinRoom::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes room = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_room();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PJoinRoom::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.information.PJoinRoom)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes room = 1;
+  if (!this->_internal_room().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_room(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.information.PJoinRoom)
+  return target;
+}
+
+size_t PJoinRoom::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.information.PJoinRoom)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes room = 1;
+  if (!this->_internal_room().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_room());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PJoinRoom::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PJoinRoom::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PJoinRoom::GetClassData() const { return &_class_data_; }
+
+
+void PJoinRoom::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PJoinRoom*>(&to_msg);
+  auto& from = static_cast<const PJoinRoom&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.information.PJoinRoom)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_room().empty()) {
+    _this->_internal_set_room(from._internal_room());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PJoinRoom::CopyFrom(const PJoinRoom& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.information.PJoinRoom)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PJoinRoom::IsInitialized() const {
+  return true;
+}
+
+void PJoinRoom::InternalSwap(PJoinRoom* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.room_, lhs_arena,
+      &other->_impl_.room_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PJoinRoom::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Protocal_2eproto_getter, &descriptor_table_Protocal_2eproto_once,
+      file_level_metadata_Protocal_2eproto[8]);
+}
+
+// ===================================================================
+
+class PLeaveRoom::_Internal {
+ public:
+};
+
+PLeaveRoom::PLeaveRoom(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:chat.information.PLeaveRoom)
+}
+PLeaveRoom::PLeaveRoom(const PLeaveRoom& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  PLeaveRoom* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:chat.information.PLeaveRoom)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PLeaveRoom::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PLeaveRoom::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata PLeaveRoom::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Protocal_2eproto_getter, &descriptor_table_Protocal_2eproto_once,
+      file_level_metadata_Protocal_2eproto[9]);
+}
+
+// ===================================================================
+
+class PDirectMessage::_Internal {
+ public:
+};
+
+PDirectMessage::PDirectMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.information.PDirectMessage)
+}
+PDirectMessage::PDirectMessage(const PDirectMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PDirectMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.to_){}
+    , decltype(_impl_.from_){}
+    , decltype(_impl_.information_){}
+    , decltype(_impl_.time_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.to_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.to_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_to().empty()) {
+    _this->_impl_.to_.Set(from._internal_to(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.from_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.from_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_from().empty()) {
+    _this->_impl_.from_.Set(from._internal_from(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.information_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.information_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_information().empty()) {
+    _this->_impl_.information_.Set(from._internal_information(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.time_ = from._impl_.time_;
+  // @@protoc_insertion_point(copy_constructor:chat.information.PDirectMessage)
+}
+
+inline void PDirectMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.to_){}
+    , decltype(_impl_.from_){}
+    , decltype(_impl_.information_){}
+    , decltype(_impl_.time_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.to_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.to_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.from_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.from_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.information_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.information_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PDirectMessage::~PDirectMessage() {
+  // @@protoc_insertion_point(destructor:chat.information.PDirectMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PDirectMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.to_.Destroy();
+  _impl_.from_.Destroy();
+  _impl_.information_.Destroy();
+}
+
+void PDirectMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PDirectMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.information.PDirectMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.to_.ClearToEmpty();
+  _impl_.from_.ClearToEmpty();
+  _impl_.information_.ClearToEmpty();
+  _impl_.time_ = int64_t{0};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PDirectMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes to = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_to();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes from = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_from();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes information = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_information();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 time = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
-void PRoomInformation::InternalSwap(PRoomInformation* other) {
+
+uint8_t* PDirectMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.information.PDirectMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes to = 1;
+  if (!this->_internal_to().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_to(), target);
+  }
+
+  // bytes from = 2;
+  if (!this->_internal_from().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_from(), target);
+  }
+
+  // bytes information = 3;
+  if (!this->_internal_information().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_information(), target);
+  }
+
+  // int64 time = 4;
+  if (this->_internal_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_time(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.information.PDirectMessage)
+  return target;
+}
+
+size_t PDirectMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.information.PDirectMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes to = 1;
+  if (!this->_internal_to().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_to());
+  }
+
+  // bytes from = 2;
+  if (!this->_internal_from().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_from());
+  }
+
+  // bytes information = 3;
+  if (!this->_internal_information().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_information());
+  }
+
+  // int64 time = 4;
+  if (this->_internal_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_time());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PDirectMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PDirectMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PDirectMessage::GetClassData() const { return &_class_data_; }
+
+
+void PDirectMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PDirectMessage*>(&to_msg);
+  auto& from = static_cast<const PDirectMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.information.PDirectMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_to().empty()) {
+    _this->_internal_set_to(from._internal_to());
+  }
+  if (!from._internal_from().empty()) {
+    _this->_internal_set_from(from._internal_from());
+  }
+  if (!from._internal_information().empty()) {
+    _this->_internal_set_information(from._internal_information());
+  }
+  if (from._internal_time() != 0) {
+    _this->_internal_set_time(from._internal_time());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PDirectMessage::CopyFrom(const PDirectMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.information.PDirectMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PDirectMessage::IsInitialized() const {
+  return true;
+}
+
+void PDirectMessage::InternalSwap(PDirectMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.to_, lhs_arena,
+      &other->_impl_.to_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.from_, lhs_arena,
+      &other->_impl_.from_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.information_, lhs_arena,
+      &other->_impl_.information_, rhs_arena
+  );
+  swap(_impl_.time_, other->_impl_.time_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PDirectMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Protocal_2eproto_getter, &descriptor_table_Protocal_2eproto_once,
+      file_level_metadata_Protocal_2eproto[10]);
+}
+
+// ===================================================================
+
+class PPresenceQuery::_Internal {
+ public:
+};
+
+PPresenceQuery::PPresenceQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.information.PPresenceQuery)
+}
+PPresenceQuery::PPresenceQuery(const PPresenceQuery& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PPresenceQuery* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.since_version_){}
+    , decltype(_impl_.subscription_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.since_version_, &from._impl_.since_version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.subscription_) -
+    reinterpret_cast<char*>(&_impl_.since_version_)) + sizeof(_impl_.subscription_));
+  // @@protoc_insertion_point(copy_constructor:chat.information.PPresenceQuery)
+}
+
+inline void PPresenceQuery::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.since_version_){uint64_t{0u}}
+    , decltype(_impl_.subscription_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PPresenceQuery::~PPresenceQuery() {
+  // @@protoc_insertion_point(destructor:chat.information.PPresenceQuery)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PPresenceQuery::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PPresenceQuery::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PPresenceQuery::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.information.PPresenceQuery)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.since_version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.subscription_) -
+      reinterpret_cast<char*>(&_impl_.since_version_)) + sizeof(_impl_.subscription_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PPresenceQuery::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 since_version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.since_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.information.PPresenceQuery.Subscription subscription = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_subscription(static_cast<::chat::information::PPresenceQuery_Subscription>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PPresenceQuery::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.information.PPresenceQuery)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 since_version = 1;
+  if (this->_internal_since_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_since_version(), target);
+  }
+
+  // .chat.information.PPresenceQuery.Subscription subscription = 2;
+  if (this->_internal_subscription() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_subscription(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.information.PPresenceQuery)
+  return target;
+}
+
+size_t PPresenceQuery::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.information.PPresenceQuery)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 since_version = 1;
+  if (this->_internal_since_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_since_version());
+  }
+
+  // .chat.information.PPresenceQuery.Subscription subscription = 2;
+  if (this->_internal_subscription() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_subscription());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PPresenceQuery::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PPresenceQuery::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PPresenceQuery::GetClassData() const { return &_class_data_; }
+
+
+void PPresenceQuery::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PPresenceQuery*>(&to_msg);
+  auto& from = static_cast<const PPresenceQuery&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.information.PPresenceQuery)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_since_version() != 0) {
+    _this->_internal_set_since_version(from._internal_since_version());
+  }
+  if (from._internal_subscription() != 0) {
+    _this->_internal_set_subscription(from._internal_subscription());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PPresenceQuery::CopyFrom(const PPresenceQuery& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.information.PPresenceQuery)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PPresenceQuery::IsInitialized() const {
+  return true;
+}
+
+void PPresenceQuery::InternalSwap(PPresenceQuery* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PPresenceQuery, _impl_.subscription_)
+      + sizeof(PPresenceQuery::_impl_.subscription_)
+      - PROTOBUF_FIELD_OFFSET(PPresenceQuery, _impl_.since_version_)>(
+          reinterpret_cast<char*>(&_impl_.since_version_),
+          reinterpret_cast<char*>(&other->_impl_.since_version_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PPresenceQuery::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Protocal_2eproto_getter, &descriptor_table_Protocal_2eproto_once,
+      file_level_metadata_Protocal_2eproto[11]);
+}
+
+// ===================================================================
+
+class PPresenceMember::_Internal {
+ public:
+};
+
+PPresenceMember::PPresenceMember(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.information.PPresenceMember)
+}
+PPresenceMember::PPresenceMember(const PPresenceMember& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PPresenceMember* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.id_ = from._impl_.id_;
+  // @@protoc_insertion_point(copy_constructor:chat.information.PPresenceMember)
+}
+
+inline void PPresenceMember::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.id_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PPresenceMember::~PPresenceMember() {
+  // @@protoc_insertion_point(destructor:chat.information.PPresenceMember)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PPresenceMember::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void PPresenceMember::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PPresenceMember::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.information.PPresenceMember)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  _impl_.id_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PPresenceMember::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PPresenceMember::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.information.PPresenceMember)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_id(), target);
+  }
+
+  // bytes name = 2;
+  if (!this->_internal_name().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.information.PPresenceMember)
+  return target;
+}
+
+size_t PPresenceMember::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.information.PPresenceMember)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes name = 2;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_name());
+  }
+
+  // uint64 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PPresenceMember::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PPresenceMember::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PPresenceMember::GetClassData() const { return &_class_data_; }
+
+
+void PPresenceMember::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PPresenceMember*>(&to_msg);
+  auto& from = static_cast<const PPresenceMember&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.information.PPresenceMember)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PPresenceMember::CopyFrom(const PPresenceMember& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.information.PPresenceMember)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PPresenceMember::IsInitialized() const {
+  return true;
+}
+
+void PPresenceMember::InternalSwap(PPresenceMember* other) {
   using std::swap;
-  name_.Swap(&other->name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  information_.Swap(&other->information_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(time_, other->time_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.id_, other->_impl_.id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PPresenceMember::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Protocal_2eproto_getter, &descriptor_table_Protocal_2eproto_once,
+      file_level_metadata_Protocal_2eproto[12]);
+}
+
+// ===================================================================
+
+class PPresenceDelta::_Internal {
+ public:
+};
+
+PPresenceDelta::PPresenceDelta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.information.PPresenceDelta)
+}
+PPresenceDelta::PPresenceDelta(const PPresenceDelta& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PPresenceDelta* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.kind_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.kind_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.kind_));
+  // @@protoc_insertion_point(copy_constructor:chat.information.PPresenceDelta)
+}
+
+inline void PPresenceDelta::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.id_){uint64_t{0u}}
+    , decltype(_impl_.kind_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PPresenceDelta::~PPresenceDelta() {
+  // @@protoc_insertion_point(destructor:chat.information.PPresenceDelta)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PPresenceDelta::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void PPresenceDelta::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PPresenceDelta::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.information.PPresenceDelta)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.kind_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.kind_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PPresenceDelta::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .chat.information.PPresenceDelta.Kind kind = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_kind(static_cast<::chat::information::PPresenceDelta_Kind>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes name = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PPresenceDelta::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.information.PPresenceDelta)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .chat.information.PPresenceDelta.Kind kind = 1;
+  if (this->_internal_kind() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_kind(), target);
+  }
+
+  // uint64 id = 2;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_id(), target);
+  }
+
+  // bytes name = 3;
+  if (!this->_internal_name().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.information.PPresenceDelta)
+  return target;
 }
 
-::google::protobuf::Metadata PRoomInformation::GetMetadata() const {
-  protobuf_Protocal_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_Protocal_2eproto::file_level_metadata[kIndexInFileMessages];
+size_t PPresenceDelta::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.information.PPresenceDelta)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes name = 3;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_name());
+  }
+
+  // uint64 id = 2;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_id());
+  }
+
+  // .chat.information.PPresenceDelta.Kind kind = 1;
+  if (this->_internal_kind() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_kind());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PPresenceDelta::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PPresenceDelta::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PPresenceDelta::GetClassData() const { return &_class_data_; }
+
 
-// ===================================================================
+void PPresenceDelta::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PPresenceDelta*>(&to_msg);
+  auto& from = static_cast<const PPresenceDelta&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.information.PPresenceDelta)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void PServerErrorMessage::InitAsDefaultInstance() {
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_kind() != 0) {
+    _this->_internal_set_kind(from._internal_kind());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PServerErrorMessage::kMesFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-PServerErrorMessage::PServerErrorMessage()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_Protocal_2eproto::scc_info_PServerErrorMessage.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:chat.information.PServerErrorMessage)
+void PPresenceDelta::CopyFrom(const PPresenceDelta& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.information.PPresenceDelta)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
-PServerErrorMessage::PServerErrorMessage(const PServerErrorMessage& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  mes_ = from.mes_;
-  // @@protoc_insertion_point(copy_constructor:chat.information.PServerErrorMessage)
+
+bool PPresenceDelta::IsInitialized() const {
+  return true;
 }
 
-void PServerErrorMessage::SharedCtor() {
-  mes_ = 0;
+void PPresenceDelta::InternalSwap(PPresenceDelta* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PPresenceDelta, _impl_.kind_)
+      + sizeof(PPresenceDelta::_impl_.kind_)
+      - PROTOBUF_FIELD_OFFSET(PPresenceDelta, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
 }
 
-PServerErrorMessage::~PServerErrorMessage() {
-  // @@protoc_insertion_point(destructor:chat.information.PServerErrorMessage)
-  SharedDtor();
+::PROTOBUF_NAMESPACE_ID::Metadata PPresenceDelta::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Protocal_2eproto_getter, &descriptor_table_Protocal_2eproto_once,
+      file_level_metadata_Protocal_2eproto[13]);
 }
 
-void PServerErrorMessage::SharedDtor() {
+// ===================================================================
+
+class PPresence::_Internal {
+ public:
+};
+
+PPresence::PPresence(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.information.PPresence)
+}
+PPresence::PPresence(const PPresence& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PPresence* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.members_){from._impl_.members_}
+    , decltype(_impl_.deltas_){from._impl_.deltas_}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.page_){}
+    , decltype(_impl_.snapshot_){}
+    , decltype(_impl_.last_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.last_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.last_));
+  // @@protoc_insertion_point(copy_constructor:chat.information.PPresence)
 }
 
-void PServerErrorMessage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+inline void PPresence::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.members_){arena}
+    , decltype(_impl_.deltas_){arena}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.page_){0u}
+    , decltype(_impl_.snapshot_){false}
+    , decltype(_impl_.last_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
-const ::google::protobuf::Descriptor* PServerErrorMessage::descriptor() {
-  ::protobuf_Protocal_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_Protocal_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+
+PPresence::~PPresence() {
+  // @@protoc_insertion_point(destructor:chat.information.PPresence)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-const PServerErrorMessage& PServerErrorMessage::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_Protocal_2eproto::scc_info_PServerErrorMessage.base);
-  return *internal_default_instance();
+inline void PPresence::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.members_.~RepeatedPtrField();
+  _impl_.deltas_.~RepeatedPtrField();
 }
 
+void PPresence::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
-void PServerErrorMessage::Clear() {
-// @@protoc_insertion_point(message_clear_start:chat.information.PServerErrorMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void PPresence::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.information.PPresence)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  mes_ = 0;
-  _internal_metadata_.Clear();
+  _impl_.members_.Clear();
+  _impl_.deltas_.Clear();
+  ::memset(&_impl_.version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.last_) -
+      reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.last_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool PServerErrorMessage::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:chat.information.PServerErrorMessage)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .chat.information.PServerErrorMessage.ErrorMessage mes = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_mes(static_cast< ::chat::information::PServerErrorMessage_ErrorMessage >(value));
-        } else {
+const char* PPresence::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool snapshot = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.snapshot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 page = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.page_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      // bool last = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.last_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.information.PPresenceMember members = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_members(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.information.PPresenceDelta deltas = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_deltas(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:chat.information.PServerErrorMessage)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:chat.information.PServerErrorMessage)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void PServerErrorMessage::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:chat.information.PServerErrorMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* PPresence::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.information.PPresence)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .chat.information.PServerErrorMessage.ErrorMessage mes = 1;
-  if (this->mes() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->mes(), output);
+  // uint64 version = 1;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_version(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  // bool snapshot = 2;
+  if (this->_internal_snapshot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_snapshot(), target);
   }
-  // @@protoc_insertion_point(serialize_end:chat.information.PServerErrorMessage)
-}
 
-::google::protobuf::uint8* PServerErrorMessage::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:chat.information.PServerErrorMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // uint32 page = 3;
+  if (this->_internal_page() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_page(), target);
+  }
 
-  // .chat.information.PServerErrorMessage.ErrorMessage mes = 1;
-  if (this->mes() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->mes(), target);
+  // bool last = 4;
+  if (this->_internal_last() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_last(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  // repeated .chat.information.PPresenceMember members = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_members_size()); i < n; i++) {
+    const auto& repfield = this->_internal_members(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:chat.information.PServerErrorMessage)
+
+  // repeated .chat.information.PPresenceDelta deltas = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_deltas_size()); i < n; i++) {
+    const auto& repfield = this->_internal_deltas(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.information.PPresence)
   return target;
 }
 
-size_t PServerErrorMessage::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:chat.information.PServerErrorMessage)
+size_t PPresence::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.information.PPresence)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chat.information.PPresenceMember members = 5;
+  total_size += 1UL * this->_internal_members_size();
+  for (const auto& msg : this->_impl_.members_) {
     total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  // .chat.information.PServerErrorMessage.ErrorMessage mes = 1;
-  if (this->mes() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->mes());
+
+  // repeated .chat.information.PPresenceDelta deltas = 6;
+  total_size += 1UL * this->_internal_deltas_size();
+  for (const auto& msg : this->_impl_.deltas_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // uint64 version = 1;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
+
+  // uint32 page = 3;
+  if (this->_internal_page() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_page());
+  }
+
+  // bool snapshot = 2;
+  if (this->_internal_snapshot() != 0) {
+    total_size += 1 + 1;
+  }
 
-void PServerErrorMessage::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:chat.information.PServerErrorMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PServerErrorMessage* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PServerErrorMessage>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:chat.information.PServerErrorMessage)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:chat.information.PServerErrorMessage)
-    MergeFrom(*source);
+  // bool last = 4;
+  if (this->_internal_last() != 0) {
+    total_size += 1 + 1;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PServerErrorMessage::MergeFrom(const PServerErrorMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:chat.information.PServerErrorMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PPresence::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PPresence::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PPresence::GetClassData() const { return &_class_data_; }
+
+
+void PPresence::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PPresence*>(&to_msg);
+  auto& from = static_cast<const PPresence&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.information.PPresence)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.mes() != 0) {
-    set_mes(from.mes());
+  _this->_impl_.members_.MergeFrom(from._impl_.members_);
+  _this->_impl_.deltas_.MergeFrom(from._impl_.deltas_);
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  if (from._internal_page() != 0) {
+    _this->_internal_set_page(from._internal_page());
   }
+  if (from._internal_snapshot() != 0) {
+    _this->_internal_set_snapshot(from._internal_snapshot());
+  }
+  if (from._internal_last() != 0) {
+    _this->_internal_set_last(from._internal_last());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void PServerErrorMessage::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:chat.information.PServerErrorMessage)
+void PPresence::CopyFrom(const PPresence& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.information.PPresence)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void PServerErrorMessage::CopyFrom(const PServerErrorMessage& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:chat.information.PServerErrorMessage)
+bool PPresence::IsInitialized() const {
+  return true;
+}
+
+void PPresence::InternalSwap(PPresence* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.members_.InternalSwap(&other->_impl_.members_);
+  _impl_.deltas_.InternalSwap(&other->_impl_.deltas_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PPresence, _impl_.last_)
+      + sizeof(PPresence::_impl_.last_)
+      - PROTOBUF_FIELD_OFFSET(PPresence, _impl_.version_)>(
+          reinterpret_cast<char*>(&_impl_.version_),
+          reinterpret_cast<char*>(&other->_impl_.version_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PPresence::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Protocal_2eproto_getter, &descriptor_table_Protocal_2eproto_once,
+      file_level_metadata_Protocal_2eproto[14]);
+}
+
+// ===================================================================
+
+class PHistoryQuery::_Internal {
+ public:
+};
+
+PHistoryQuery::PHistoryQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.information.PHistoryQuery)
+}
+PHistoryQuery::PHistoryQuery(const PHistoryQuery& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PHistoryQuery* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.before_seq_){}
+    , decltype(_impl_.count_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.before_seq_, &from._impl_.before_seq_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.count_) -
+    reinterpret_cast<char*>(&_impl_.before_seq_)) + sizeof(_impl_.count_));
+  // @@protoc_insertion_point(copy_constructor:chat.information.PHistoryQuery)
+}
+
+inline void PHistoryQuery::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.before_seq_){uint64_t{0u}}
+    , decltype(_impl_.count_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PHistoryQuery::~PHistoryQuery() {
+  // @@protoc_insertion_point(destructor:chat.information.PHistoryQuery)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PHistoryQuery::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PHistoryQuery::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PHistoryQuery::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.information.PHistoryQuery)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.before_seq_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.count_) -
+      reinterpret_cast<char*>(&_impl_.before_seq_)) + sizeof(_impl_.count_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PHistoryQuery::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 before_seq = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.before_seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PHistoryQuery::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.information.PHistoryQuery)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 before_seq = 1;
+  if (this->_internal_before_seq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_before_seq(), target);
+  }
+
+  // uint32 count = 2;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_count(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.information.PHistoryQuery)
+  return target;
+}
+
+size_t PHistoryQuery::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.information.PHistoryQuery)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 before_seq = 1;
+  if (this->_internal_before_seq() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_before_seq());
+  }
+
+  // uint32 count = 2;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_count());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PHistoryQuery::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PHistoryQuery::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PHistoryQuery::GetClassData() const { return &_class_data_; }
+
+
+void PHistoryQuery::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PHistoryQuery*>(&to_msg);
+  auto& from = static_cast<const PHistoryQuery&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.information.PHistoryQuery)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_before_seq() != 0) {
+    _this->_internal_set_before_seq(from._internal_before_seq());
+  }
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PHistoryQuery::CopyFrom(const PHistoryQuery& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.information.PHistoryQuery)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool PServerErrorMessage::IsInitialized() const {
+bool PHistoryQuery::IsInitialized() const {
   return true;
 }
 
-void PServerErrorMessage::Swap(PServerErrorMessage* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void PServerErrorMessage::InternalSwap(PServerErrorMessage* other) {
+void PHistoryQuery::InternalSwap(PHistoryQuery* other) {
   using std::swap;
-  swap(mes_, other->mes_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PHistoryQuery, _impl_.count_)
+      + sizeof(PHistoryQuery::_impl_.count_)
+      - PROTOBUF_FIELD_OFFSET(PHistoryQuery, _impl_.before_seq_)>(
+          reinterpret_cast<char*>(&_impl_.before_seq_),
+          reinterpret_cast<char*>(&other->_impl_.before_seq_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PHistoryQuery::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Protocal_2eproto_getter, &descriptor_table_Protocal_2eproto_once,
+      file_level_metadata_Protocal_2eproto[15]);
+}
+
+// ===================================================================
+
+class PHistory::_Internal {
+ public:
+};
+
+PHistory::PHistory(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.information.PHistory)
+}
+PHistory::PHistory(const PHistory& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PHistory* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.first_seq_){}
+    , decltype(_impl_.count_){}
+    , decltype(_impl_.bytes_){}
+    , decltype(_impl_.last_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.first_seq_, &from._impl_.first_seq_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.last_) -
+    reinterpret_cast<char*>(&_impl_.first_seq_)) + sizeof(_impl_.last_));
+  // @@protoc_insertion_point(copy_constructor:chat.information.PHistory)
+}
+
+inline void PHistory::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.first_seq_){uint64_t{0u}}
+    , decltype(_impl_.count_){0u}
+    , decltype(_impl_.bytes_){0u}
+    , decltype(_impl_.last_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PHistory::~PHistory() {
+  // @@protoc_insertion_point(destructor:chat.information.PHistory)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PHistory::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PHistory::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PHistory::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.information.PHistory)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.first_seq_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.last_) -
+      reinterpret_cast<char*>(&_impl_.first_seq_)) + sizeof(_impl_.last_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PHistory::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 first_seq = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.first_seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 bytes = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool last = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.last_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PHistory::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.information.PHistory)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 first_seq = 1;
+  if (this->_internal_first_seq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_first_seq(), target);
+  }
+
+  // uint32 count = 2;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_count(), target);
+  }
+
+  // uint32 bytes = 3;
+  if (this->_internal_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_bytes(), target);
+  }
+
+  // bool last = 4;
+  if (this->_internal_last() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_last(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.information.PHistory)
+  return target;
+}
+
+size_t PHistory::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.information.PHistory)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 first_seq = 1;
+  if (this->_internal_first_seq() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_first_seq());
+  }
+
+  // uint32 count = 2;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_count());
+  }
+
+  // uint32 bytes = 3;
+  if (this->_internal_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bytes());
+  }
+
+  // bool last = 4;
+  if (this->_internal_last() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PHistory::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PHistory::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PHistory::GetClassData() const { return &_class_data_; }
+
+
+void PHistory::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PHistory*>(&to_msg);
+  auto& from = static_cast<const PHistory&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.information.PHistory)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_first_seq() != 0) {
+    _this->_internal_set_first_seq(from._internal_first_seq());
+  }
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  if (from._internal_bytes() != 0) {
+    _this->_internal_set_bytes(from._internal_bytes());
+  }
+  if (from._internal_last() != 0) {
+    _this->_internal_set_last(from._internal_last());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PHistory::CopyFrom(const PHistory& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.information.PHistory)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PHistory::IsInitialized() const {
+  return true;
 }
 
-::google::protobuf::Metadata PServerErrorMessage::GetMetadata() const {
-  protobuf_Protocal_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_Protocal_2eproto::file_level_metadata[kIndexInFileMessages];
+void PHistory::InternalSwap(PHistory* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PHistory, _impl_.last_)
+      + sizeof(PHistory::_impl_.last_)
+      - PROTOBUF_FIELD_OFFSET(PHistory, _impl_.first_seq_)>(
+          reinterpret_cast<char*>(&_impl_.first_seq_),
+          reinterpret_cast<char*>(&other->_impl_.first_seq_));
 }
 
+::PROTOBUF_NAMESPACE_ID::Metadata PHistory::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Protocal_2eproto_getter, &descriptor_table_Protocal_2eproto_once,
+      file_level_metadata_Protocal_2eproto[16]);
+}
 
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace information
 }  // namespace chat
-namespace google {
-namespace protobuf {
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::chat::information::PBindName* Arena::CreateMaybeMessage< ::chat::information::PBindName >(Arena* arena) {
-  return Arena::CreateInternal< ::chat::information::PBindName >(arena);
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::chat::information::PBindName*
+Arena::CreateMaybeMessage< ::chat::information::PBindName >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::information::PBindName >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::information::PChat*
+Arena::CreateMaybeMessage< ::chat::information::PChat >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::information::PChat >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::information::PRoomInformation*
+Arena::CreateMaybeMessage< ::chat::information::PRoomInformation >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::information::PRoomInformation >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::information::PChunk*
+Arena::CreateMaybeMessage< ::chat::information::PChunk >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::information::PChunk >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::information::PBatchRecord*
+Arena::CreateMaybeMessage< ::chat::information::PBatchRecord >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::information::PBatchRecord >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::information::PRoomBatch*
+Arena::CreateMaybeMessage< ::chat::information::PRoomBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::information::PRoomBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::information::PServerErrorMessage*
+Arena::CreateMaybeMessage< ::chat::information::PServerErrorMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::information::PServerErrorMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::information::PHello*
+Arena::CreateMaybeMessage< ::chat::information::PHello >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::information::PHello >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::information::PJoinRoom*
+Arena::CreateMaybeMessage< ::chat::information::PJoinRoom >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::information::PJoinRoom >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::information::PLeaveRoom*
+Arena::CreateMaybeMessage< ::chat::information::PLeaveRoom >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::information::PLeaveRoom >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::information::PDirectMessage*
+Arena::CreateMaybeMessage< ::chat::information::PDirectMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::information::PDirectMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::information::PPresenceQuery*
+Arena::CreateMaybeMessage< ::chat::information::PPresenceQuery >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::information::PPresenceQuery >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::information::PPresenceMember*
+Arena::CreateMaybeMessage< ::chat::information::PPresenceMember >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::information::PPresenceMember >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::information::PPresenceDelta*
+Arena::CreateMaybeMessage< ::chat::information::PPresenceDelta >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::information::PPresenceDelta >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::chat::information::PChat* Arena::CreateMaybeMessage< ::chat::information::PChat >(Arena* arena) {
-  return Arena::CreateInternal< ::chat::information::PChat >(arena);
+template<> PROTOBUF_NOINLINE ::chat::information::PPresence*
+Arena::CreateMaybeMessage< ::chat::information::PPresence >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::information::PPresence >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::chat::information::PRoomInformation* Arena::CreateMaybeMessage< ::chat::information::PRoomInformation >(Arena* arena) {
-  return Arena::CreateInternal< ::chat::information::PRoomInformation >(arena);
+template<> PROTOBUF_NOINLINE ::chat::information::PHistoryQuery*
+Arena::CreateMaybeMessage< ::chat::information::PHistoryQuery >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::information::PHistoryQuery >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::chat::information::PServerErrorMessage* Arena::CreateMaybeMessage< ::chat::information::PServerErrorMessage >(Arena* arena) {
-  return Arena::CreateInternal< ::chat::information::PServerErrorMessage >(arena);
+template<> PROTOBUF_NOINLINE ::chat::information::PHistory*
+Arena::CreateMaybeMessage< ::chat::information::PHistory >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::information::PHistory >(arena);
 }
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
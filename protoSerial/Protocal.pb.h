@@ -1,130 +1,250 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: Protocal.proto
 
-#ifndef PROTOBUF_INCLUDED_Protocal_2eproto
-#define PROTOBUF_INCLUDED_Protocal_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_Protocal_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_Protocal_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006001
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3006001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_bases.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_Protocal_2eproto 
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_Protocal_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_Protocal_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[4];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_Protocal_2eproto {
+  static const uint32_t offsets[];
 };
-void AddDescriptors();
-}  // namespace protobuf_Protocal_2eproto
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_Protocal_2eproto;
 namespace chat {
 namespace information {
+class PBatchRecord;
+struct PBatchRecordDefaultTypeInternal;
+extern PBatchRecordDefaultTypeInternal _PBatchRecord_default_instance_;
 class PBindName;
-class PBindNameDefaultTypeInternal;
+struct PBindNameDefaultTypeInternal;
 extern PBindNameDefaultTypeInternal _PBindName_default_instance_;
 class PChat;
-class PChatDefaultTypeInternal;
+struct PChatDefaultTypeInternal;
 extern PChatDefaultTypeInternal _PChat_default_instance_;
+class PChunk;
+struct PChunkDefaultTypeInternal;
+extern PChunkDefaultTypeInternal _PChunk_default_instance_;
+class PDirectMessage;
+struct PDirectMessageDefaultTypeInternal;
+extern PDirectMessageDefaultTypeInternal _PDirectMessage_default_instance_;
+class PHello;
+struct PHelloDefaultTypeInternal;
+extern PHelloDefaultTypeInternal _PHello_default_instance_;
+class PHistory;
+struct PHistoryDefaultTypeInternal;
+extern PHistoryDefaultTypeInternal _PHistory_default_instance_;
+class PHistoryQuery;
+struct PHistoryQueryDefaultTypeInternal;
+extern PHistoryQueryDefaultTypeInternal _PHistoryQuery_default_instance_;
+class PJoinRoom;
+struct PJoinRoomDefaultTypeInternal;
+extern PJoinRoomDefaultTypeInternal _PJoinRoom_default_instance_;
+class PLeaveRoom;
+struct PLeaveRoomDefaultTypeInternal;
+extern PLeaveRoomDefaultTypeInternal _PLeaveRoom_default_instance_;
+class PPresence;
+struct PPresenceDefaultTypeInternal;
+extern PPresenceDefaultTypeInternal _PPresence_default_instance_;
+class PPresenceDelta;
+struct PPresenceDeltaDefaultTypeInternal;
+extern PPresenceDeltaDefaultTypeInternal _PPresenceDelta_default_instance_;
+class PPresenceMember;
+struct PPresenceMemberDefaultTypeInternal;
+extern PPresenceMemberDefaultTypeInternal _PPresenceMember_default_instance_;
+class PPresenceQuery;
+struct PPresenceQueryDefaultTypeInternal;
+extern PPresenceQueryDefaultTypeInternal _PPresenceQuery_default_instance_;
+class PRoomBatch;
+struct PRoomBatchDefaultTypeInternal;
+extern PRoomBatchDefaultTypeInternal _PRoomBatch_default_instance_;
 class PRoomInformation;
-class PRoomInformationDefaultTypeInternal;
+struct PRoomInformationDefaultTypeInternal;
 extern PRoomInformationDefaultTypeInternal _PRoomInformation_default_instance_;
 class PServerErrorMessage;
-class PServerErrorMessageDefaultTypeInternal;
+struct PServerErrorMessageDefaultTypeInternal;
 extern PServerErrorMessageDefaultTypeInternal _PServerErrorMessage_default_instance_;
 }  // namespace information
 }  // namespace chat
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
+template<> ::chat::information::PBatchRecord* Arena::CreateMaybeMessage<::chat::information::PBatchRecord>(Arena*);
 template<> ::chat::information::PBindName* Arena::CreateMaybeMessage<::chat::information::PBindName>(Arena*);
 template<> ::chat::information::PChat* Arena::CreateMaybeMessage<::chat::information::PChat>(Arena*);
+template<> ::chat::information::PChunk* Arena::CreateMaybeMessage<::chat::information::PChunk>(Arena*);
+template<> ::chat::information::PDirectMessage* Arena::CreateMaybeMessage<::chat::information::PDirectMessage>(Arena*);
+template<> ::chat::information::PHello* Arena::CreateMaybeMessage<::chat::information::PHello>(Arena*);
+template<> ::chat::information::PHistory* Arena::CreateMaybeMessage<::chat::information::PHistory>(Arena*);
+template<> ::chat::information::PHistoryQuery* Arena::CreateMaybeMessage<::chat::information::PHistoryQuery>(Arena*);
+template<> ::chat::information::PJoinRoom* Arena::CreateMaybeMessage<::chat::information::PJoinRoom>(Arena*);
+template<> ::chat::information::PLeaveRoom* Arena::CreateMaybeMessage<::chat::information::PLeaveRoom>(Arena*);
+template<> ::chat::information::PPresence* Arena::CreateMaybeMessage<::chat::information::PPresence>(Arena*);
+template<> ::chat::information::PPresenceDelta* Arena::CreateMaybeMessage<::chat::information::PPresenceDelta>(Arena*);
+template<> ::chat::information::PPresenceMember* Arena::CreateMaybeMessage<::chat::information::PPresenceMember>(Arena*);
+template<> ::chat::information::PPresenceQuery* Arena::CreateMaybeMessage<::chat::information::PPresenceQuery>(Arena*);
+template<> ::chat::information::PRoomBatch* Arena::CreateMaybeMessage<::chat::information::PRoomBatch>(Arena*);
 template<> ::chat::information::PRoomInformation* Arena::CreateMaybeMessage<::chat::information::PRoomInformation>(Arena*);
 template<> ::chat::information::PServerErrorMessage* Arena::CreateMaybeMessage<::chat::information::PServerErrorMessage>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 namespace chat {
 namespace information {
 
-enum PServerErrorMessage_ErrorMessage {
+enum PServerErrorMessage_ErrorMessage : int {
   PServerErrorMessage_ErrorMessage_BodyTooLong = 0,
-  PServerErrorMessage_ErrorMessage_PServerErrorMessage_ErrorMessage_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  PServerErrorMessage_ErrorMessage_PServerErrorMessage_ErrorMessage_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  PServerErrorMessage_ErrorMessage_UserNotFound = 1,
+  PServerErrorMessage_ErrorMessage_PServerErrorMessage_ErrorMessage_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  PServerErrorMessage_ErrorMessage_PServerErrorMessage_ErrorMessage_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool PServerErrorMessage_ErrorMessage_IsValid(int value);
-const PServerErrorMessage_ErrorMessage PServerErrorMessage_ErrorMessage_ErrorMessage_MIN = PServerErrorMessage_ErrorMessage_BodyTooLong;
-const PServerErrorMessage_ErrorMessage PServerErrorMessage_ErrorMessage_ErrorMessage_MAX = PServerErrorMessage_ErrorMessage_BodyTooLong;
-const int PServerErrorMessage_ErrorMessage_ErrorMessage_ARRAYSIZE = PServerErrorMessage_ErrorMessage_ErrorMessage_MAX + 1;
+constexpr PServerErrorMessage_ErrorMessage PServerErrorMessage_ErrorMessage_ErrorMessage_MIN = PServerErrorMessage_ErrorMessage_BodyTooLong;
+constexpr PServerErrorMessage_ErrorMessage PServerErrorMessage_ErrorMessage_ErrorMessage_MAX = PServerErrorMessage_ErrorMessage_UserNotFound;
+constexpr int PServerErrorMessage_ErrorMessage_ErrorMessage_ARRAYSIZE = PServerErrorMessage_ErrorMessage_ErrorMessage_MAX + 1;
 
-const ::google::protobuf::EnumDescriptor* PServerErrorMessage_ErrorMessage_descriptor();
-inline const ::std::string& PServerErrorMessage_ErrorMessage_Name(PServerErrorMessage_ErrorMessage value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    PServerErrorMessage_ErrorMessage_descriptor(), value);
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PServerErrorMessage_ErrorMessage_descriptor();
+template<typename T>
+inline const std::string& PServerErrorMessage_ErrorMessage_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, PServerErrorMessage_ErrorMessage>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function PServerErrorMessage_ErrorMessage_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    PServerErrorMessage_ErrorMessage_descriptor(), enum_t_value);
 }
 inline bool PServerErrorMessage_ErrorMessage_Parse(
-    const ::std::string& name, PServerErrorMessage_ErrorMessage* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<PServerErrorMessage_ErrorMessage>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PServerErrorMessage_ErrorMessage* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<PServerErrorMessage_ErrorMessage>(
     PServerErrorMessage_ErrorMessage_descriptor(), name, value);
 }
+enum PPresenceQuery_Subscription : int {
+  PPresenceQuery_Subscription_KEEP = 0,
+  PPresenceQuery_Subscription_SUBSCRIBE = 1,
+  PPresenceQuery_Subscription_UNSUBSCRIBE = 2,
+  PPresenceQuery_Subscription_PPresenceQuery_Subscription_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  PPresenceQuery_Subscription_PPresenceQuery_Subscription_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool PPresenceQuery_Subscription_IsValid(int value);
+constexpr PPresenceQuery_Subscription PPresenceQuery_Subscription_Subscription_MIN = PPresenceQuery_Subscription_KEEP;
+constexpr PPresenceQuery_Subscription PPresenceQuery_Subscription_Subscription_MAX = PPresenceQuery_Subscription_UNSUBSCRIBE;
+constexpr int PPresenceQuery_Subscription_Subscription_ARRAYSIZE = PPresenceQuery_Subscription_Subscription_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PPresenceQuery_Subscription_descriptor();
+template<typename T>
+inline const std::string& PPresenceQuery_Subscription_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, PPresenceQuery_Subscription>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function PPresenceQuery_Subscription_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    PPresenceQuery_Subscription_descriptor(), enum_t_value);
+}
+inline bool PPresenceQuery_Subscription_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PPresenceQuery_Subscription* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<PPresenceQuery_Subscription>(
+    PPresenceQuery_Subscription_descriptor(), name, value);
+}
+enum PPresenceDelta_Kind : int {
+  PPresenceDelta_Kind_JOIN = 0,
+  PPresenceDelta_Kind_LEAVE = 1,
+  PPresenceDelta_Kind_RENAME = 2,
+  PPresenceDelta_Kind_PPresenceDelta_Kind_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  PPresenceDelta_Kind_PPresenceDelta_Kind_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool PPresenceDelta_Kind_IsValid(int value);
+constexpr PPresenceDelta_Kind PPresenceDelta_Kind_Kind_MIN = PPresenceDelta_Kind_JOIN;
+constexpr PPresenceDelta_Kind PPresenceDelta_Kind_Kind_MAX = PPresenceDelta_Kind_RENAME;
+constexpr int PPresenceDelta_Kind_Kind_ARRAYSIZE = PPresenceDelta_Kind_Kind_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PPresenceDelta_Kind_descriptor();
+template<typename T>
+inline const std::string& PPresenceDelta_Kind_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, PPresenceDelta_Kind>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function PPresenceDelta_Kind_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    PPresenceDelta_Kind_descriptor(), enum_t_value);
+}
+inline bool PPresenceDelta_Kind_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PPresenceDelta_Kind* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<PPresenceDelta_Kind>(
+    PPresenceDelta_Kind_descriptor(), name, value);
+}
 // ===================================================================
 
-class PBindName : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:chat.information.PBindName) */ {
+class PBindName final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.information.PBindName) */ {
  public:
-  PBindName();
-  virtual ~PBindName();
+  inline PBindName() : PBindName(nullptr) {}
+  ~PBindName() override;
+  explicit PROTOBUF_CONSTEXPR PBindName(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PBindName(const PBindName& from);
-
-  inline PBindName& operator=(const PBindName& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   PBindName(PBindName&& from) noexcept
     : PBindName() {
     *this = ::std::move(from);
   }
 
+  inline PBindName& operator=(const PBindName& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline PBindName& operator=(PBindName&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PBindName& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PBindName& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PBindName* internal_default_instance() {
     return reinterpret_cast<const PBindName*>(
                &_PBindName_default_instance_);
@@ -132,110 +252,152 @@ class PBindName : public ::google::protobuf::Message /* @@protoc_insertion_point
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(PBindName* other);
   friend void swap(PBindName& a, PBindName& b) {
     a.Swap(&b);
   }
+  inline void Swap(PBindName* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PBindName* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PBindName* New() const final {
-    return CreateMaybeMessage<PBindName>(NULL);
-  }
-
-  PBindName* New(::google::protobuf::Arena* arena) const final {
+  PBindName* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PBindName>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PBindName& from);
-  void MergeFrom(const PBindName& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PBindName& from) {
+    PBindName::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PBindName* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.information.PBindName";
   }
+  protected:
+  explicit PBindName(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+  };
   // bytes name = 1;
   void clear_name();
-  static const int kNameFieldNumber = 1;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_name(::std::string&& value);
-  #endif
-  void set_name(const char* value);
-  void set_name(const void* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // @@protoc_insertion_point(class_scope:chat.information.PBindName)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_Protocal_2eproto::TableStruct;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Protocal_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PChat : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:chat.information.PChat) */ {
+class PChat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.information.PChat) */ {
  public:
-  PChat();
-  virtual ~PChat();
+  inline PChat() : PChat(nullptr) {}
+  ~PChat() override;
+  explicit PROTOBUF_CONSTEXPR PChat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PChat(const PChat& from);
-
-  inline PChat& operator=(const PChat& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   PChat(PChat&& from) noexcept
     : PChat() {
     *this = ::std::move(from);
   }
 
+  inline PChat& operator=(const PChat& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline PChat& operator=(PChat&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PChat& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PChat& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PChat* internal_default_instance() {
     return reinterpret_cast<const PChat*>(
                &_PChat_default_instance_);
@@ -243,110 +405,152 @@ class PChat : public ::google::protobuf::Message /* @@protoc_insertion_point(cla
   static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(PChat* other);
   friend void swap(PChat& a, PChat& b) {
     a.Swap(&b);
   }
+  inline void Swap(PChat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PChat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PChat* New() const final {
-    return CreateMaybeMessage<PChat>(NULL);
-  }
-
-  PChat* New(::google::protobuf::Arena* arena) const final {
+  PChat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PChat>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PChat& from);
-  void MergeFrom(const PChat& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PChat& from) {
+    PChat::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PChat* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.information.PChat";
   }
+  protected:
+  explicit PChat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kInformationFieldNumber = 1,
+  };
   // bytes information = 1;
   void clear_information();
-  static const int kInformationFieldNumber = 1;
-  const ::std::string& information() const;
-  void set_information(const ::std::string& value);
-  #if LANG_CXX11
-  void set_information(::std::string&& value);
-  #endif
-  void set_information(const char* value);
-  void set_information(const void* value, size_t size);
-  ::std::string* mutable_information();
-  ::std::string* release_information();
-  void set_allocated_information(::std::string* information);
+  const std::string& information() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_information(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_information();
+  PROTOBUF_NODISCARD std::string* release_information();
+  void set_allocated_information(std::string* information);
+  private:
+  const std::string& _internal_information() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_information(const std::string& value);
+  std::string* _internal_mutable_information();
+  public:
 
   // @@protoc_insertion_point(class_scope:chat.information.PChat)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr information_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_Protocal_2eproto::TableStruct;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr information_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Protocal_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PRoomInformation : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:chat.information.PRoomInformation) */ {
+class PRoomInformation final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.information.PRoomInformation) */ {
  public:
-  PRoomInformation();
-  virtual ~PRoomInformation();
+  inline PRoomInformation() : PRoomInformation(nullptr) {}
+  ~PRoomInformation() override;
+  explicit PROTOBUF_CONSTEXPR PRoomInformation(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PRoomInformation(const PRoomInformation& from);
-
-  inline PRoomInformation& operator=(const PRoomInformation& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   PRoomInformation(PRoomInformation&& from) noexcept
     : PRoomInformation() {
     *this = ::std::move(from);
   }
 
+  inline PRoomInformation& operator=(const PRoomInformation& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline PRoomInformation& operator=(PRoomInformation&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PRoomInformation& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PRoomInformation& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PRoomInformation* internal_default_instance() {
     return reinterpret_cast<const PRoomInformation*>(
                &_PRoomInformation_default_instance_);
@@ -354,488 +558,4070 @@ class PRoomInformation : public ::google::protobuf::Message /* @@protoc_insertio
   static constexpr int kIndexInFileMessages =
     2;
 
-  void Swap(PRoomInformation* other);
   friend void swap(PRoomInformation& a, PRoomInformation& b) {
     a.Swap(&b);
   }
+  inline void Swap(PRoomInformation* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PRoomInformation* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PRoomInformation* New() const final {
-    return CreateMaybeMessage<PRoomInformation>(NULL);
-  }
-
-  PRoomInformation* New(::google::protobuf::Arena* arena) const final {
+  PRoomInformation* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PRoomInformation>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PRoomInformation& from);
-  void MergeFrom(const PRoomInformation& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PRoomInformation& from) {
+    PRoomInformation::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PRoomInformation* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.information.PRoomInformation";
   }
+  protected:
+  explicit PRoomInformation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 2,
+    kInformationFieldNumber = 3,
+    kTimeFieldNumber = 1,
+  };
   // bytes name = 2;
   void clear_name();
-  static const int kNameFieldNumber = 2;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_name(::std::string&& value);
-  #endif
-  void set_name(const char* value);
-  void set_name(const void* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // bytes information = 3;
   void clear_information();
-  static const int kInformationFieldNumber = 3;
-  const ::std::string& information() const;
-  void set_information(const ::std::string& value);
-  #if LANG_CXX11
-  void set_information(::std::string&& value);
-  #endif
-  void set_information(const char* value);
-  void set_information(const void* value, size_t size);
-  ::std::string* mutable_information();
-  ::std::string* release_information();
-  void set_allocated_information(::std::string* information);
+  const std::string& information() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_information(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_information();
+  PROTOBUF_NODISCARD std::string* release_information();
+  void set_allocated_information(std::string* information);
+  private:
+  const std::string& _internal_information() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_information(const std::string& value);
+  std::string* _internal_mutable_information();
+  public:
 
   // int64 time = 1;
   void clear_time();
-  static const int kTimeFieldNumber = 1;
-  ::google::protobuf::int64 time() const;
-  void set_time(::google::protobuf::int64 value);
+  int64_t time() const;
+  void set_time(int64_t value);
+  private:
+  int64_t _internal_time() const;
+  void _internal_set_time(int64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:chat.information.PRoomInformation)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  ::google::protobuf::internal::ArenaStringPtr information_;
-  ::google::protobuf::int64 time_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_Protocal_2eproto::TableStruct;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr information_;
+    int64_t time_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Protocal_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PServerErrorMessage : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:chat.information.PServerErrorMessage) */ {
+class PChunk final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.information.PChunk) */ {
  public:
-  PServerErrorMessage();
-  virtual ~PServerErrorMessage();
+  inline PChunk() : PChunk(nullptr) {}
+  ~PChunk() override;
+  explicit PROTOBUF_CONSTEXPR PChunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  PServerErrorMessage(const PServerErrorMessage& from);
+  PChunk(const PChunk& from);
+  PChunk(PChunk&& from) noexcept
+    : PChunk() {
+    *this = ::std::move(from);
+  }
 
-  inline PServerErrorMessage& operator=(const PServerErrorMessage& from) {
+  inline PChunk& operator=(const PChunk& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
-  PServerErrorMessage(PServerErrorMessage&& from) noexcept
-    : PServerErrorMessage() {
-    *this = ::std::move(from);
-  }
-
-  inline PServerErrorMessage& operator=(PServerErrorMessage&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline PChunk& operator=(PChunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PServerErrorMessage& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const PServerErrorMessage* internal_default_instance() {
-    return reinterpret_cast<const PServerErrorMessage*>(
-               &_PServerErrorMessage_default_instance_);
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PChunk& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PChunk* internal_default_instance() {
+    return reinterpret_cast<const PChunk*>(
+               &_PChunk_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     3;
 
-  void Swap(PServerErrorMessage* other);
-  friend void swap(PServerErrorMessage& a, PServerErrorMessage& b) {
+  friend void swap(PChunk& a, PChunk& b) {
     a.Swap(&b);
   }
+  inline void Swap(PChunk* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PChunk* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PServerErrorMessage* New() const final {
-    return CreateMaybeMessage<PServerErrorMessage>(NULL);
+  PChunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PChunk>(arena);
   }
-
-  PServerErrorMessage* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<PServerErrorMessage>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PChunk& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PChunk& from) {
+    PChunk::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
-  void CopyFrom(const PServerErrorMessage& from);
-  void MergeFrom(const PServerErrorMessage& from);
-  void Clear() final;
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(PServerErrorMessage* other);
+  void InternalSwap(PChunk* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.information.PChunk";
   }
+  protected:
+  explicit PChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // nested types ----------------------------------------------------
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  typedef PServerErrorMessage_ErrorMessage ErrorMessage;
-  static const ErrorMessage BodyTooLong =
-    PServerErrorMessage_ErrorMessage_BodyTooLong;
-  static inline bool ErrorMessage_IsValid(int value) {
-    return PServerErrorMessage_ErrorMessage_IsValid(value);
-  }
-  static const ErrorMessage ErrorMessage_MIN =
-    PServerErrorMessage_ErrorMessage_ErrorMessage_MIN;
-  static const ErrorMessage ErrorMessage_MAX =
-    PServerErrorMessage_ErrorMessage_ErrorMessage_MAX;
-  static const int ErrorMessage_ARRAYSIZE =
-    PServerErrorMessage_ErrorMessage_ErrorMessage_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  ErrorMessage_descriptor() {
-    return PServerErrorMessage_ErrorMessage_descriptor();
-  }
-  static inline const ::std::string& ErrorMessage_Name(ErrorMessage value) {
-    return PServerErrorMessage_ErrorMessage_Name(value);
-  }
-  static inline bool ErrorMessage_Parse(const ::std::string& name,
-      ErrorMessage* value) {
-    return PServerErrorMessage_ErrorMessage_Parse(name, value);
-  }
+  // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // .chat.information.PServerErrorMessage.ErrorMessage mes = 1;
-  void clear_mes();
-  static const int kMesFieldNumber = 1;
-  ::chat::information::PServerErrorMessage_ErrorMessage mes() const;
-  void set_mes(::chat::information::PServerErrorMessage_ErrorMessage value);
+  enum : int {
+    kDataFieldNumber = 4,
+    kNameFieldNumber = 5,
+    kIdFieldNumber = 1,
+    kIndexFieldNumber = 2,
+    kLastFieldNumber = 3,
+    kTimeFieldNumber = 6,
+  };
+  // bytes data = 4;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
 
-  // @@protoc_insertion_point(class_scope:chat.information.PServerErrorMessage)
+  // bytes name = 5;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint64 id = 1;
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // uint32 index = 2;
+  void clear_index();
+  uint32_t index() const;
+  void set_index(uint32_t value);
+  private:
+  uint32_t _internal_index() const;
+  void _internal_set_index(uint32_t value);
+  public:
+
+  // bool last = 3;
+  void clear_last();
+  bool last() const;
+  void set_last(bool value);
+  private:
+  bool _internal_last() const;
+  void _internal_set_last(bool value);
+  public:
+
+  // int64 time = 6;
+  void clear_time();
+  int64_t time() const;
+  void set_time(int64_t value);
+  private:
+  int64_t _internal_time() const;
+  void _internal_set_time(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.information.PChunk)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  int mes_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_Protocal_2eproto::TableStruct;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t id_;
+    uint32_t index_;
+    bool last_;
+    int64_t time_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Protocal_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class PBatchRecord final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.information.PBatchRecord) */ {
+ public:
+  inline PBatchRecord() : PBatchRecord(nullptr) {}
+  ~PBatchRecord() override;
+  explicit PROTOBUF_CONSTEXPR PBatchRecord(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  PBatchRecord(const PBatchRecord& from);
+  PBatchRecord(PBatchRecord&& from) noexcept
+    : PBatchRecord() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// PBindName
+  inline PBatchRecord& operator=(const PBatchRecord& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PBatchRecord& operator=(PBatchRecord&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// bytes name = 1;
-inline void PBindName::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& PBindName::name() const {
-  // @@protoc_insertion_point(field_get:chat.information.PBindName.name)
-  return name_.GetNoArena();
-}
-inline void PBindName::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:chat.information.PBindName.name)
-}
-#if LANG_CXX11
-inline void PBindName::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:chat.information.PBindName.name)
-}
-#endif
-inline void PBindName::set_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:chat.information.PBindName.name)
-}
-inline void PBindName::set_name(const void* value, size_t size) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:chat.information.PBindName.name)
-}
-inline ::std::string* PBindName::mutable_name() {
-  
-  // @@protoc_insertion_point(field_mutable:chat.information.PBindName.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline ::std::string* PBindName::release_name() {
-  // @@protoc_insertion_point(field_release:chat.information.PBindName.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void PBindName::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
-    
-  } else {
-    
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
-  // @@protoc_insertion_point(field_set_allocated:chat.information.PBindName.name)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PBatchRecord& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PBatchRecord* internal_default_instance() {
+    return reinterpret_cast<const PBatchRecord*>(
+               &_PBatchRecord_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
 
-// -------------------------------------------------------------------
+  friend void swap(PBatchRecord& a, PBatchRecord& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PBatchRecord* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PBatchRecord* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-// PChat
+  // implements Message ----------------------------------------------
 
-// bytes information = 1;
-inline void PChat::clear_information() {
-  information_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& PChat::information() const {
-  // @@protoc_insertion_point(field_get:chat.information.PChat.information)
-  return information_.GetNoArena();
-}
-inline void PChat::set_information(const ::std::string& value) {
-  
-  information_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:chat.information.PChat.information)
-}
-#if LANG_CXX11
-inline void PChat::set_information(::std::string&& value) {
-  
-  information_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:chat.information.PChat.information)
-}
-#endif
-inline void PChat::set_information(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  information_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:chat.information.PChat.information)
-}
-inline void PChat::set_information(const void* value, size_t size) {
-  
-  information_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:chat.information.PChat.information)
-}
-inline ::std::string* PChat::mutable_information() {
-  
-  // @@protoc_insertion_point(field_mutable:chat.information.PChat.information)
-  return information_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline ::std::string* PChat::release_information() {
-  // @@protoc_insertion_point(field_release:chat.information.PChat.information)
-  
-  return information_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void PChat::set_allocated_information(::std::string* information) {
-  if (information != NULL) {
-    
-  } else {
-    
+  PBatchRecord* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PBatchRecord>(arena);
   }
-  information_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), information);
-  // @@protoc_insertion_point(field_set_allocated:chat.information.PChat.information)
-}
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PBatchRecord& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PBatchRecord& from) {
+    PBatchRecord::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-// -------------------------------------------------------------------
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PBatchRecord* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.information.PBatchRecord";
+  }
+  protected:
+  explicit PBatchRecord(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInformationFieldNumber = 3,
+    kTimeDeltaFieldNumber = 2,
+    kNameIndexFieldNumber = 1,
+  };
+  // bytes information = 3;
+  void clear_information();
+  const std::string& information() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_information(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_information();
+  PROTOBUF_NODISCARD std::string* release_information();
+  void set_allocated_information(std::string* information);
+  private:
+  const std::string& _internal_information() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_information(const std::string& value);
+  std::string* _internal_mutable_information();
+  public:
+
+  // sint64 time_delta = 2;
+  void clear_time_delta();
+  int64_t time_delta() const;
+  void set_time_delta(int64_t value);
+  private:
+  int64_t _internal_time_delta() const;
+  void _internal_set_time_delta(int64_t value);
+  public:
+
+  // uint32 name_index = 1;
+  void clear_name_index();
+  uint32_t name_index() const;
+  void set_name_index(uint32_t value);
+  private:
+  uint32_t _internal_name_index() const;
+  void _internal_set_name_index(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.information.PBatchRecord)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr information_;
+    int64_t time_delta_;
+    uint32_t name_index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Protocal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PRoomBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.information.PRoomBatch) */ {
+ public:
+  inline PRoomBatch() : PRoomBatch(nullptr) {}
+  ~PRoomBatch() override;
+  explicit PROTOBUF_CONSTEXPR PRoomBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PRoomBatch(const PRoomBatch& from);
+  PRoomBatch(PRoomBatch&& from) noexcept
+    : PRoomBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline PRoomBatch& operator=(const PRoomBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PRoomBatch& operator=(PRoomBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PRoomBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PRoomBatch* internal_default_instance() {
+    return reinterpret_cast<const PRoomBatch*>(
+               &_PRoomBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(PRoomBatch& a, PRoomBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PRoomBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PRoomBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PRoomBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PRoomBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PRoomBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PRoomBatch& from) {
+    PRoomBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PRoomBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.information.PRoomBatch";
+  }
+  protected:
+  explicit PRoomBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNamesFieldNumber = 2,
+    kRecordsFieldNumber = 3,
+    kBaseTimeFieldNumber = 1,
+  };
+  // repeated bytes names = 2;
+  int names_size() const;
+  private:
+  int _internal_names_size() const;
+  public:
+  void clear_names();
+  const std::string& names(int index) const;
+  std::string* mutable_names(int index);
+  void set_names(int index, const std::string& value);
+  void set_names(int index, std::string&& value);
+  void set_names(int index, const char* value);
+  void set_names(int index, const void* value, size_t size);
+  std::string* add_names();
+  void add_names(const std::string& value);
+  void add_names(std::string&& value);
+  void add_names(const char* value);
+  void add_names(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& names() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_names();
+  private:
+  const std::string& _internal_names(int index) const;
+  std::string* _internal_add_names();
+  public:
+
+  // repeated .chat.information.PBatchRecord records = 3;
+  int records_size() const;
+  private:
+  int _internal_records_size() const;
+  public:
+  void clear_records();
+  ::chat::information::PBatchRecord* mutable_records(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::information::PBatchRecord >*
+      mutable_records();
+  private:
+  const ::chat::information::PBatchRecord& _internal_records(int index) const;
+  ::chat::information::PBatchRecord* _internal_add_records();
+  public:
+  const ::chat::information::PBatchRecord& records(int index) const;
+  ::chat::information::PBatchRecord* add_records();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::information::PBatchRecord >&
+      records() const;
+
+  // int64 base_time = 1;
+  void clear_base_time();
+  int64_t base_time() const;
+  void set_base_time(int64_t value);
+  private:
+  int64_t _internal_base_time() const;
+  void _internal_set_base_time(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.information.PRoomBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> names_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::information::PBatchRecord > records_;
+    int64_t base_time_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Protocal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PServerErrorMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.information.PServerErrorMessage) */ {
+ public:
+  inline PServerErrorMessage() : PServerErrorMessage(nullptr) {}
+  ~PServerErrorMessage() override;
+  explicit PROTOBUF_CONSTEXPR PServerErrorMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PServerErrorMessage(const PServerErrorMessage& from);
+  PServerErrorMessage(PServerErrorMessage&& from) noexcept
+    : PServerErrorMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline PServerErrorMessage& operator=(const PServerErrorMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PServerErrorMessage& operator=(PServerErrorMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PServerErrorMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PServerErrorMessage* internal_default_instance() {
+    return reinterpret_cast<const PServerErrorMessage*>(
+               &_PServerErrorMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(PServerErrorMessage& a, PServerErrorMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PServerErrorMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PServerErrorMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PServerErrorMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PServerErrorMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PServerErrorMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PServerErrorMessage& from) {
+    PServerErrorMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PServerErrorMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.information.PServerErrorMessage";
+  }
+  protected:
+  explicit PServerErrorMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef PServerErrorMessage_ErrorMessage ErrorMessage;
+  static constexpr ErrorMessage BodyTooLong =
+    PServerErrorMessage_ErrorMessage_BodyTooLong;
+  static constexpr ErrorMessage UserNotFound =
+    PServerErrorMessage_ErrorMessage_UserNotFound;
+  static inline bool ErrorMessage_IsValid(int value) {
+    return PServerErrorMessage_ErrorMessage_IsValid(value);
+  }
+  static constexpr ErrorMessage ErrorMessage_MIN =
+    PServerErrorMessage_ErrorMessage_ErrorMessage_MIN;
+  static constexpr ErrorMessage ErrorMessage_MAX =
+    PServerErrorMessage_ErrorMessage_ErrorMessage_MAX;
+  static constexpr int ErrorMessage_ARRAYSIZE =
+    PServerErrorMessage_ErrorMessage_ErrorMessage_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  ErrorMessage_descriptor() {
+    return PServerErrorMessage_ErrorMessage_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& ErrorMessage_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, ErrorMessage>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function ErrorMessage_Name.");
+    return PServerErrorMessage_ErrorMessage_Name(enum_t_value);
+  }
+  static inline bool ErrorMessage_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      ErrorMessage* value) {
+    return PServerErrorMessage_ErrorMessage_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMesFieldNumber = 1,
+  };
+  // .chat.information.PServerErrorMessage.ErrorMessage mes = 1;
+  void clear_mes();
+  ::chat::information::PServerErrorMessage_ErrorMessage mes() const;
+  void set_mes(::chat::information::PServerErrorMessage_ErrorMessage value);
+  private:
+  ::chat::information::PServerErrorMessage_ErrorMessage _internal_mes() const;
+  void _internal_set_mes(::chat::information::PServerErrorMessage_ErrorMessage value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.information.PServerErrorMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int mes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Protocal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PHello final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.information.PHello) */ {
+ public:
+  inline PHello() : PHello(nullptr) {}
+  ~PHello() override;
+  explicit PROTOBUF_CONSTEXPR PHello(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PHello(const PHello& from);
+  PHello(PHello&& from) noexcept
+    : PHello() {
+    *this = ::std::move(from);
+  }
+
+  inline PHello& operator=(const PHello& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PHello& operator=(PHello&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PHello& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PHello* internal_default_instance() {
+    return reinterpret_cast<const PHello*>(
+               &_PHello_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(PHello& a, PHello& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PHello* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PHello* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PHello* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PHello>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PHello& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PHello& from) {
+    PHello::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PHello* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.information.PHello";
+  }
+  protected:
+  explicit PHello(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFeaturesFieldNumber = 1,
+  };
+  // uint32 features = 1;
+  void clear_features();
+  uint32_t features() const;
+  void set_features(uint32_t value);
+  private:
+  uint32_t _internal_features() const;
+  void _internal_set_features(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.information.PHello)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t features_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Protocal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PJoinRoom final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.information.PJoinRoom) */ {
+ public:
+  inline PJoinRoom() : PJoinRoom(nullptr) {}
+  ~PJoinRoom() override;
+  explicit PROTOBUF_CONSTEXPR PJoinRoom(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PJoinRoom(const PJoinRoom& from);
+  PJoinRoom(PJoinRoom&& from) noexcept
+    : PJoinRoom() {
+    *this = ::std::move(from);
+  }
+
+  inline PJoinRoom& operator=(const PJoinRoom& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PJoinRoom& operator=(PJoinRoom&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PJoinRoom& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PJoinRoom* internal_default_instance() {
+    return reinterpret_cast<const PJoinRoom*>(
+               &_PJoinRoom_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(PJoinRoom& a, PJoinRoom& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PJoinRoom* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PJoinRoom* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PJoinRoom* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PJoinRoom>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PJoinRoom& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PJoinRoom& from) {
+    PJoinRoom::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PJoinRoom* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.information.PJoinRoom";
+  }
+  protected:
+  explicit PJoinRoom(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoomFieldNumber = 1,
+  };
+  // bytes room = 1;
+  void clear_room();
+  const std::string& room() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_room(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_room();
+  PROTOBUF_NODISCARD std::string* release_room();
+  void set_allocated_room(std::string* room);
+  private:
+  const std::string& _internal_room() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_room(const std::string& value);
+  std::string* _internal_mutable_room();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.information.PJoinRoom)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr room_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Protocal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PLeaveRoom final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:chat.information.PLeaveRoom) */ {
+ public:
+  inline PLeaveRoom() : PLeaveRoom(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR PLeaveRoom(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PLeaveRoom(const PLeaveRoom& from);
+  PLeaveRoom(PLeaveRoom&& from) noexcept
+    : PLeaveRoom() {
+    *this = ::std::move(from);
+  }
+
+  inline PLeaveRoom& operator=(const PLeaveRoom& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PLeaveRoom& operator=(PLeaveRoom&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PLeaveRoom& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PLeaveRoom* internal_default_instance() {
+    return reinterpret_cast<const PLeaveRoom*>(
+               &_PLeaveRoom_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(PLeaveRoom& a, PLeaveRoom& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PLeaveRoom* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PLeaveRoom* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PLeaveRoom* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PLeaveRoom>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const PLeaveRoom& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const PLeaveRoom& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.information.PLeaveRoom";
+  }
+  protected:
+  explicit PLeaveRoom(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:chat.information.PLeaveRoom)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_Protocal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PDirectMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.information.PDirectMessage) */ {
+ public:
+  inline PDirectMessage() : PDirectMessage(nullptr) {}
+  ~PDirectMessage() override;
+  explicit PROTOBUF_CONSTEXPR PDirectMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PDirectMessage(const PDirectMessage& from);
+  PDirectMessage(PDirectMessage&& from) noexcept
+    : PDirectMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline PDirectMessage& operator=(const PDirectMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PDirectMessage& operator=(PDirectMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PDirectMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PDirectMessage* internal_default_instance() {
+    return reinterpret_cast<const PDirectMessage*>(
+               &_PDirectMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(PDirectMessage& a, PDirectMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PDirectMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PDirectMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PDirectMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PDirectMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PDirectMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PDirectMessage& from) {
+    PDirectMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PDirectMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.information.PDirectMessage";
+  }
+  protected:
+  explicit PDirectMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kToFieldNumber = 1,
+    kFromFieldNumber = 2,
+    kInformationFieldNumber = 3,
+    kTimeFieldNumber = 4,
+  };
+  // bytes to = 1;
+  void clear_to();
+  const std::string& to() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_to(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_to();
+  PROTOBUF_NODISCARD std::string* release_to();
+  void set_allocated_to(std::string* to);
+  private:
+  const std::string& _internal_to() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_to(const std::string& value);
+  std::string* _internal_mutable_to();
+  public:
+
+  // bytes from = 2;
+  void clear_from();
+  const std::string& from() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_from(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_from();
+  PROTOBUF_NODISCARD std::string* release_from();
+  void set_allocated_from(std::string* from);
+  private:
+  const std::string& _internal_from() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_from(const std::string& value);
+  std::string* _internal_mutable_from();
+  public:
+
+  // bytes information = 3;
+  void clear_information();
+  const std::string& information() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_information(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_information();
+  PROTOBUF_NODISCARD std::string* release_information();
+  void set_allocated_information(std::string* information);
+  private:
+  const std::string& _internal_information() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_information(const std::string& value);
+  std::string* _internal_mutable_information();
+  public:
+
+  // int64 time = 4;
+  void clear_time();
+  int64_t time() const;
+  void set_time(int64_t value);
+  private:
+  int64_t _internal_time() const;
+  void _internal_set_time(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.information.PDirectMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr to_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr from_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr information_;
+    int64_t time_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Protocal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PPresenceQuery final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.information.PPresenceQuery) */ {
+ public:
+  inline PPresenceQuery() : PPresenceQuery(nullptr) {}
+  ~PPresenceQuery() override;
+  explicit PROTOBUF_CONSTEXPR PPresenceQuery(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PPresenceQuery(const PPresenceQuery& from);
+  PPresenceQuery(PPresenceQuery&& from) noexcept
+    : PPresenceQuery() {
+    *this = ::std::move(from);
+  }
+
+  inline PPresenceQuery& operator=(const PPresenceQuery& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PPresenceQuery& operator=(PPresenceQuery&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PPresenceQuery& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PPresenceQuery* internal_default_instance() {
+    return reinterpret_cast<const PPresenceQuery*>(
+               &_PPresenceQuery_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(PPresenceQuery& a, PPresenceQuery& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PPresenceQuery* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PPresenceQuery* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PPresenceQuery* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PPresenceQuery>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PPresenceQuery& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PPresenceQuery& from) {
+    PPresenceQuery::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PPresenceQuery* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.information.PPresenceQuery";
+  }
+  protected:
+  explicit PPresenceQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef PPresenceQuery_Subscription Subscription;
+  static constexpr Subscription KEEP =
+    PPresenceQuery_Subscription_KEEP;
+  static constexpr Subscription SUBSCRIBE =
+    PPresenceQuery_Subscription_SUBSCRIBE;
+  static constexpr Subscription UNSUBSCRIBE =
+    PPresenceQuery_Subscription_UNSUBSCRIBE;
+  static inline bool Subscription_IsValid(int value) {
+    return PPresenceQuery_Subscription_IsValid(value);
+  }
+  static constexpr Subscription Subscription_MIN =
+    PPresenceQuery_Subscription_Subscription_MIN;
+  static constexpr Subscription Subscription_MAX =
+    PPresenceQuery_Subscription_Subscription_MAX;
+  static constexpr int Subscription_ARRAYSIZE =
+    PPresenceQuery_Subscription_Subscription_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Subscription_descriptor() {
+    return PPresenceQuery_Subscription_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Subscription_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Subscription>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Subscription_Name.");
+    return PPresenceQuery_Subscription_Name(enum_t_value);
+  }
+  static inline bool Subscription_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Subscription* value) {
+    return PPresenceQuery_Subscription_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSinceVersionFieldNumber = 1,
+    kSubscriptionFieldNumber = 2,
+  };
+  // uint64 since_version = 1;
+  void clear_since_version();
+  uint64_t since_version() const;
+  void set_since_version(uint64_t value);
+  private:
+  uint64_t _internal_since_version() const;
+  void _internal_set_since_version(uint64_t value);
+  public:
+
+  // .chat.information.PPresenceQuery.Subscription subscription = 2;
+  void clear_subscription();
+  ::chat::information::PPresenceQuery_Subscription subscription() const;
+  void set_subscription(::chat::information::PPresenceQuery_Subscription value);
+  private:
+  ::chat::information::PPresenceQuery_Subscription _internal_subscription() const;
+  void _internal_set_subscription(::chat::information::PPresenceQuery_Subscription value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.information.PPresenceQuery)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t since_version_;
+    int subscription_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Protocal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PPresenceMember final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.information.PPresenceMember) */ {
+ public:
+  inline PPresenceMember() : PPresenceMember(nullptr) {}
+  ~PPresenceMember() override;
+  explicit PROTOBUF_CONSTEXPR PPresenceMember(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PPresenceMember(const PPresenceMember& from);
+  PPresenceMember(PPresenceMember&& from) noexcept
+    : PPresenceMember() {
+    *this = ::std::move(from);
+  }
+
+  inline PPresenceMember& operator=(const PPresenceMember& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PPresenceMember& operator=(PPresenceMember&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PPresenceMember& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PPresenceMember* internal_default_instance() {
+    return reinterpret_cast<const PPresenceMember*>(
+               &_PPresenceMember_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(PPresenceMember& a, PPresenceMember& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PPresenceMember* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PPresenceMember* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PPresenceMember* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PPresenceMember>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PPresenceMember& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PPresenceMember& from) {
+    PPresenceMember::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PPresenceMember* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.information.PPresenceMember";
+  }
+  protected:
+  explicit PPresenceMember(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 2,
+    kIdFieldNumber = 1,
+  };
+  // bytes name = 2;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint64 id = 1;
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.information.PPresenceMember)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Protocal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PPresenceDelta final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.information.PPresenceDelta) */ {
+ public:
+  inline PPresenceDelta() : PPresenceDelta(nullptr) {}
+  ~PPresenceDelta() override;
+  explicit PROTOBUF_CONSTEXPR PPresenceDelta(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PPresenceDelta(const PPresenceDelta& from);
+  PPresenceDelta(PPresenceDelta&& from) noexcept
+    : PPresenceDelta() {
+    *this = ::std::move(from);
+  }
+
+  inline PPresenceDelta& operator=(const PPresenceDelta& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PPresenceDelta& operator=(PPresenceDelta&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PPresenceDelta& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PPresenceDelta* internal_default_instance() {
+    return reinterpret_cast<const PPresenceDelta*>(
+               &_PPresenceDelta_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(PPresenceDelta& a, PPresenceDelta& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PPresenceDelta* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PPresenceDelta* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PPresenceDelta* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PPresenceDelta>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PPresenceDelta& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PPresenceDelta& from) {
+    PPresenceDelta::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PPresenceDelta* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.information.PPresenceDelta";
+  }
+  protected:
+  explicit PPresenceDelta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef PPresenceDelta_Kind Kind;
+  static constexpr Kind JOIN =
+    PPresenceDelta_Kind_JOIN;
+  static constexpr Kind LEAVE =
+    PPresenceDelta_Kind_LEAVE;
+  static constexpr Kind RENAME =
+    PPresenceDelta_Kind_RENAME;
+  static inline bool Kind_IsValid(int value) {
+    return PPresenceDelta_Kind_IsValid(value);
+  }
+  static constexpr Kind Kind_MIN =
+    PPresenceDelta_Kind_Kind_MIN;
+  static constexpr Kind Kind_MAX =
+    PPresenceDelta_Kind_Kind_MAX;
+  static constexpr int Kind_ARRAYSIZE =
+    PPresenceDelta_Kind_Kind_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Kind_descriptor() {
+    return PPresenceDelta_Kind_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Kind_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Kind>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Kind_Name.");
+    return PPresenceDelta_Kind_Name(enum_t_value);
+  }
+  static inline bool Kind_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Kind* value) {
+    return PPresenceDelta_Kind_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 3,
+    kIdFieldNumber = 2,
+    kKindFieldNumber = 1,
+  };
+  // bytes name = 3;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint64 id = 2;
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // .chat.information.PPresenceDelta.Kind kind = 1;
+  void clear_kind();
+  ::chat::information::PPresenceDelta_Kind kind() const;
+  void set_kind(::chat::information::PPresenceDelta_Kind value);
+  private:
+  ::chat::information::PPresenceDelta_Kind _internal_kind() const;
+  void _internal_set_kind(::chat::information::PPresenceDelta_Kind value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.information.PPresenceDelta)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t id_;
+    int kind_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Protocal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PPresence final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.information.PPresence) */ {
+ public:
+  inline PPresence() : PPresence(nullptr) {}
+  ~PPresence() override;
+  explicit PROTOBUF_CONSTEXPR PPresence(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PPresence(const PPresence& from);
+  PPresence(PPresence&& from) noexcept
+    : PPresence() {
+    *this = ::std::move(from);
+  }
+
+  inline PPresence& operator=(const PPresence& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PPresence& operator=(PPresence&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PPresence& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PPresence* internal_default_instance() {
+    return reinterpret_cast<const PPresence*>(
+               &_PPresence_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(PPresence& a, PPresence& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PPresence* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PPresence* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PPresence* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PPresence>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PPresence& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PPresence& from) {
+    PPresence::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PPresence* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.information.PPresence";
+  }
+  protected:
+  explicit PPresence(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMembersFieldNumber = 5,
+    kDeltasFieldNumber = 6,
+    kVersionFieldNumber = 1,
+    kPageFieldNumber = 3,
+    kSnapshotFieldNumber = 2,
+    kLastFieldNumber = 4,
+  };
+  // repeated .chat.information.PPresenceMember members = 5;
+  int members_size() const;
+  private:
+  int _internal_members_size() const;
+  public:
+  void clear_members();
+  ::chat::information::PPresenceMember* mutable_members(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::information::PPresenceMember >*
+      mutable_members();
+  private:
+  const ::chat::information::PPresenceMember& _internal_members(int index) const;
+  ::chat::information::PPresenceMember* _internal_add_members();
+  public:
+  const ::chat::information::PPresenceMember& members(int index) const;
+  ::chat::information::PPresenceMember* add_members();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::information::PPresenceMember >&
+      members() const;
+
+  // repeated .chat.information.PPresenceDelta deltas = 6;
+  int deltas_size() const;
+  private:
+  int _internal_deltas_size() const;
+  public:
+  void clear_deltas();
+  ::chat::information::PPresenceDelta* mutable_deltas(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::information::PPresenceDelta >*
+      mutable_deltas();
+  private:
+  const ::chat::information::PPresenceDelta& _internal_deltas(int index) const;
+  ::chat::information::PPresenceDelta* _internal_add_deltas();
+  public:
+  const ::chat::information::PPresenceDelta& deltas(int index) const;
+  ::chat::information::PPresenceDelta* add_deltas();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::information::PPresenceDelta >&
+      deltas() const;
+
+  // uint64 version = 1;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // uint32 page = 3;
+  void clear_page();
+  uint32_t page() const;
+  void set_page(uint32_t value);
+  private:
+  uint32_t _internal_page() const;
+  void _internal_set_page(uint32_t value);
+  public:
+
+  // bool snapshot = 2;
+  void clear_snapshot();
+  bool snapshot() const;
+  void set_snapshot(bool value);
+  private:
+  bool _internal_snapshot() const;
+  void _internal_set_snapshot(bool value);
+  public:
+
+  // bool last = 4;
+  void clear_last();
+  bool last() const;
+  void set_last(bool value);
+  private:
+  bool _internal_last() const;
+  void _internal_set_last(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.information.PPresence)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::information::PPresenceMember > members_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::information::PPresenceDelta > deltas_;
+    uint64_t version_;
+    uint32_t page_;
+    bool snapshot_;
+    bool last_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Protocal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PHistoryQuery final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.information.PHistoryQuery) */ {
+ public:
+  inline PHistoryQuery() : PHistoryQuery(nullptr) {}
+  ~PHistoryQuery() override;
+  explicit PROTOBUF_CONSTEXPR PHistoryQuery(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PHistoryQuery(const PHistoryQuery& from);
+  PHistoryQuery(PHistoryQuery&& from) noexcept
+    : PHistoryQuery() {
+    *this = ::std::move(from);
+  }
+
+  inline PHistoryQuery& operator=(const PHistoryQuery& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PHistoryQuery& operator=(PHistoryQuery&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PHistoryQuery& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PHistoryQuery* internal_default_instance() {
+    return reinterpret_cast<const PHistoryQuery*>(
+               &_PHistoryQuery_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(PHistoryQuery& a, PHistoryQuery& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PHistoryQuery* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PHistoryQuery* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PHistoryQuery* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PHistoryQuery>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PHistoryQuery& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PHistoryQuery& from) {
+    PHistoryQuery::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PHistoryQuery* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.information.PHistoryQuery";
+  }
+  protected:
+  explicit PHistoryQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBeforeSeqFieldNumber = 1,
+    kCountFieldNumber = 2,
+  };
+  // uint64 before_seq = 1;
+  void clear_before_seq();
+  uint64_t before_seq() const;
+  void set_before_seq(uint64_t value);
+  private:
+  uint64_t _internal_before_seq() const;
+  void _internal_set_before_seq(uint64_t value);
+  public:
+
+  // uint32 count = 2;
+  void clear_count();
+  uint32_t count() const;
+  void set_count(uint32_t value);
+  private:
+  uint32_t _internal_count() const;
+  void _internal_set_count(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.information.PHistoryQuery)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t before_seq_;
+    uint32_t count_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Protocal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PHistory final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.information.PHistory) */ {
+ public:
+  inline PHistory() : PHistory(nullptr) {}
+  ~PHistory() override;
+  explicit PROTOBUF_CONSTEXPR PHistory(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PHistory(const PHistory& from);
+  PHistory(PHistory&& from) noexcept
+    : PHistory() {
+    *this = ::std::move(from);
+  }
+
+  inline PHistory& operator=(const PHistory& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PHistory& operator=(PHistory&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PHistory& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PHistory* internal_default_instance() {
+    return reinterpret_cast<const PHistory*>(
+               &_PHistory_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(PHistory& a, PHistory& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PHistory* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PHistory* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PHistory* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PHistory>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PHistory& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PHistory& from) {
+    PHistory::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PHistory* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.information.PHistory";
+  }
+  protected:
+  explicit PHistory(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFirstSeqFieldNumber = 1,
+    kCountFieldNumber = 2,
+    kBytesFieldNumber = 3,
+    kLastFieldNumber = 4,
+  };
+  // uint64 first_seq = 1;
+  void clear_first_seq();
+  uint64_t first_seq() const;
+  void set_first_seq(uint64_t value);
+  private:
+  uint64_t _internal_first_seq() const;
+  void _internal_set_first_seq(uint64_t value);
+  public:
+
+  // uint32 count = 2;
+  void clear_count();
+  uint32_t count() const;
+  void set_count(uint32_t value);
+  private:
+  uint32_t _internal_count() const;
+  void _internal_set_count(uint32_t value);
+  public:
+
+  // uint32 bytes = 3;
+  void clear_bytes();
+  uint32_t bytes() const;
+  void set_bytes(uint32_t value);
+  private:
+  uint32_t _internal_bytes() const;
+  void _internal_set_bytes(uint32_t value);
+  public:
+
+  // bool last = 4;
+  void clear_last();
+  bool last() const;
+  void set_last(bool value);
+  private:
+  bool _internal_last() const;
+  void _internal_set_last(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.information.PHistory)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t first_seq_;
+    uint32_t count_;
+    uint32_t bytes_;
+    bool last_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Protocal_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// PBindName
+
+// bytes name = 1;
+inline void PBindName::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& PBindName::name() const {
+  // @@protoc_insertion_point(field_get:chat.information.PBindName.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PBindName::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.information.PBindName.name)
+}
+inline std::string* PBindName::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:chat.information.PBindName.name)
+  return _s;
+}
+inline const std::string& PBindName::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void PBindName::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PBindName::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PBindName::release_name() {
+  // @@protoc_insertion_point(field_release:chat.information.PBindName.name)
+  return _impl_.name_.Release();
+}
+inline void PBindName::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.information.PBindName.name)
+}
+
+// -------------------------------------------------------------------
+
+// PChat
+
+// bytes information = 1;
+inline void PChat::clear_information() {
+  _impl_.information_.ClearToEmpty();
+}
+inline const std::string& PChat::information() const {
+  // @@protoc_insertion_point(field_get:chat.information.PChat.information)
+  return _internal_information();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PChat::set_information(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.information_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.information.PChat.information)
+}
+inline std::string* PChat::mutable_information() {
+  std::string* _s = _internal_mutable_information();
+  // @@protoc_insertion_point(field_mutable:chat.information.PChat.information)
+  return _s;
+}
+inline const std::string& PChat::_internal_information() const {
+  return _impl_.information_.Get();
+}
+inline void PChat::_internal_set_information(const std::string& value) {
+  
+  _impl_.information_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PChat::_internal_mutable_information() {
+  
+  return _impl_.information_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PChat::release_information() {
+  // @@protoc_insertion_point(field_release:chat.information.PChat.information)
+  return _impl_.information_.Release();
+}
+inline void PChat::set_allocated_information(std::string* information) {
+  if (information != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.information_.SetAllocated(information, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.information_.IsDefault()) {
+    _impl_.information_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.information.PChat.information)
+}
+
+// -------------------------------------------------------------------
 
 // PRoomInformation
 
-// int64 time = 1;
-inline void PRoomInformation::clear_time() {
-  time_ = GOOGLE_LONGLONG(0);
+// int64 time = 1;
+inline void PRoomInformation::clear_time() {
+  _impl_.time_ = int64_t{0};
+}
+inline int64_t PRoomInformation::_internal_time() const {
+  return _impl_.time_;
+}
+inline int64_t PRoomInformation::time() const {
+  // @@protoc_insertion_point(field_get:chat.information.PRoomInformation.time)
+  return _internal_time();
+}
+inline void PRoomInformation::_internal_set_time(int64_t value) {
+  
+  _impl_.time_ = value;
+}
+inline void PRoomInformation::set_time(int64_t value) {
+  _internal_set_time(value);
+  // @@protoc_insertion_point(field_set:chat.information.PRoomInformation.time)
+}
+
+// bytes name = 2;
+inline void PRoomInformation::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& PRoomInformation::name() const {
+  // @@protoc_insertion_point(field_get:chat.information.PRoomInformation.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PRoomInformation::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.information.PRoomInformation.name)
+}
+inline std::string* PRoomInformation::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:chat.information.PRoomInformation.name)
+  return _s;
+}
+inline const std::string& PRoomInformation::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void PRoomInformation::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PRoomInformation::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PRoomInformation::release_name() {
+  // @@protoc_insertion_point(field_release:chat.information.PRoomInformation.name)
+  return _impl_.name_.Release();
+}
+inline void PRoomInformation::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.information.PRoomInformation.name)
+}
+
+// bytes information = 3;
+inline void PRoomInformation::clear_information() {
+  _impl_.information_.ClearToEmpty();
+}
+inline const std::string& PRoomInformation::information() const {
+  // @@protoc_insertion_point(field_get:chat.information.PRoomInformation.information)
+  return _internal_information();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PRoomInformation::set_information(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.information_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.information.PRoomInformation.information)
+}
+inline std::string* PRoomInformation::mutable_information() {
+  std::string* _s = _internal_mutable_information();
+  // @@protoc_insertion_point(field_mutable:chat.information.PRoomInformation.information)
+  return _s;
+}
+inline const std::string& PRoomInformation::_internal_information() const {
+  return _impl_.information_.Get();
+}
+inline void PRoomInformation::_internal_set_information(const std::string& value) {
+  
+  _impl_.information_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PRoomInformation::_internal_mutable_information() {
+  
+  return _impl_.information_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PRoomInformation::release_information() {
+  // @@protoc_insertion_point(field_release:chat.information.PRoomInformation.information)
+  return _impl_.information_.Release();
+}
+inline void PRoomInformation::set_allocated_information(std::string* information) {
+  if (information != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.information_.SetAllocated(information, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.information_.IsDefault()) {
+    _impl_.information_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.information.PRoomInformation.information)
+}
+
+// -------------------------------------------------------------------
+
+// PChunk
+
+// uint64 id = 1;
+inline void PChunk::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+}
+inline uint64_t PChunk::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t PChunk::id() const {
+  // @@protoc_insertion_point(field_get:chat.information.PChunk.id)
+  return _internal_id();
+}
+inline void PChunk::_internal_set_id(uint64_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void PChunk::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:chat.information.PChunk.id)
+}
+
+// uint32 index = 2;
+inline void PChunk::clear_index() {
+  _impl_.index_ = 0u;
+}
+inline uint32_t PChunk::_internal_index() const {
+  return _impl_.index_;
+}
+inline uint32_t PChunk::index() const {
+  // @@protoc_insertion_point(field_get:chat.information.PChunk.index)
+  return _internal_index();
+}
+inline void PChunk::_internal_set_index(uint32_t value) {
+  
+  _impl_.index_ = value;
+}
+inline void PChunk::set_index(uint32_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:chat.information.PChunk.index)
+}
+
+// bool last = 3;
+inline void PChunk::clear_last() {
+  _impl_.last_ = false;
+}
+inline bool PChunk::_internal_last() const {
+  return _impl_.last_;
+}
+inline bool PChunk::last() const {
+  // @@protoc_insertion_point(field_get:chat.information.PChunk.last)
+  return _internal_last();
+}
+inline void PChunk::_internal_set_last(bool value) {
+  
+  _impl_.last_ = value;
+}
+inline void PChunk::set_last(bool value) {
+  _internal_set_last(value);
+  // @@protoc_insertion_point(field_set:chat.information.PChunk.last)
+}
+
+// bytes data = 4;
+inline void PChunk::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& PChunk::data() const {
+  // @@protoc_insertion_point(field_get:chat.information.PChunk.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PChunk::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.information.PChunk.data)
+}
+inline std::string* PChunk::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:chat.information.PChunk.data)
+  return _s;
+}
+inline const std::string& PChunk::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void PChunk::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PChunk::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PChunk::release_data() {
+  // @@protoc_insertion_point(field_release:chat.information.PChunk.data)
+  return _impl_.data_.Release();
+}
+inline void PChunk::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.information.PChunk.data)
+}
+
+// bytes name = 5;
+inline void PChunk::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& PChunk::name() const {
+  // @@protoc_insertion_point(field_get:chat.information.PChunk.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PChunk::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.information.PChunk.name)
+}
+inline std::string* PChunk::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:chat.information.PChunk.name)
+  return _s;
+}
+inline const std::string& PChunk::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void PChunk::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PChunk::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PChunk::release_name() {
+  // @@protoc_insertion_point(field_release:chat.information.PChunk.name)
+  return _impl_.name_.Release();
+}
+inline void PChunk::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.information.PChunk.name)
+}
+
+// int64 time = 6;
+inline void PChunk::clear_time() {
+  _impl_.time_ = int64_t{0};
+}
+inline int64_t PChunk::_internal_time() const {
+  return _impl_.time_;
+}
+inline int64_t PChunk::time() const {
+  // @@protoc_insertion_point(field_get:chat.information.PChunk.time)
+  return _internal_time();
+}
+inline void PChunk::_internal_set_time(int64_t value) {
+  
+  _impl_.time_ = value;
+}
+inline void PChunk::set_time(int64_t value) {
+  _internal_set_time(value);
+  // @@protoc_insertion_point(field_set:chat.information.PChunk.time)
+}
+
+// -------------------------------------------------------------------
+
+// PBatchRecord
+
+// uint32 name_index = 1;
+inline void PBatchRecord::clear_name_index() {
+  _impl_.name_index_ = 0u;
+}
+inline uint32_t PBatchRecord::_internal_name_index() const {
+  return _impl_.name_index_;
+}
+inline uint32_t PBatchRecord::name_index() const {
+  // @@protoc_insertion_point(field_get:chat.information.PBatchRecord.name_index)
+  return _internal_name_index();
+}
+inline void PBatchRecord::_internal_set_name_index(uint32_t value) {
+  
+  _impl_.name_index_ = value;
+}
+inline void PBatchRecord::set_name_index(uint32_t value) {
+  _internal_set_name_index(value);
+  // @@protoc_insertion_point(field_set:chat.information.PBatchRecord.name_index)
+}
+
+// sint64 time_delta = 2;
+inline void PBatchRecord::clear_time_delta() {
+  _impl_.time_delta_ = int64_t{0};
+}
+inline int64_t PBatchRecord::_internal_time_delta() const {
+  return _impl_.time_delta_;
+}
+inline int64_t PBatchRecord::time_delta() const {
+  // @@protoc_insertion_point(field_get:chat.information.PBatchRecord.time_delta)
+  return _internal_time_delta();
+}
+inline void PBatchRecord::_internal_set_time_delta(int64_t value) {
+  
+  _impl_.time_delta_ = value;
+}
+inline void PBatchRecord::set_time_delta(int64_t value) {
+  _internal_set_time_delta(value);
+  // @@protoc_insertion_point(field_set:chat.information.PBatchRecord.time_delta)
+}
+
+// bytes information = 3;
+inline void PBatchRecord::clear_information() {
+  _impl_.information_.ClearToEmpty();
+}
+inline const std::string& PBatchRecord::information() const {
+  // @@protoc_insertion_point(field_get:chat.information.PBatchRecord.information)
+  return _internal_information();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PBatchRecord::set_information(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.information_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.information.PBatchRecord.information)
+}
+inline std::string* PBatchRecord::mutable_information() {
+  std::string* _s = _internal_mutable_information();
+  // @@protoc_insertion_point(field_mutable:chat.information.PBatchRecord.information)
+  return _s;
+}
+inline const std::string& PBatchRecord::_internal_information() const {
+  return _impl_.information_.Get();
+}
+inline void PBatchRecord::_internal_set_information(const std::string& value) {
+  
+  _impl_.information_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PBatchRecord::_internal_mutable_information() {
+  
+  return _impl_.information_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PBatchRecord::release_information() {
+  // @@protoc_insertion_point(field_release:chat.information.PBatchRecord.information)
+  return _impl_.information_.Release();
+}
+inline void PBatchRecord::set_allocated_information(std::string* information) {
+  if (information != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.information_.SetAllocated(information, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.information_.IsDefault()) {
+    _impl_.information_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.information.PBatchRecord.information)
+}
+
+// -------------------------------------------------------------------
+
+// PRoomBatch
+
+// int64 base_time = 1;
+inline void PRoomBatch::clear_base_time() {
+  _impl_.base_time_ = int64_t{0};
+}
+inline int64_t PRoomBatch::_internal_base_time() const {
+  return _impl_.base_time_;
+}
+inline int64_t PRoomBatch::base_time() const {
+  // @@protoc_insertion_point(field_get:chat.information.PRoomBatch.base_time)
+  return _internal_base_time();
+}
+inline void PRoomBatch::_internal_set_base_time(int64_t value) {
+  
+  _impl_.base_time_ = value;
+}
+inline void PRoomBatch::set_base_time(int64_t value) {
+  _internal_set_base_time(value);
+  // @@protoc_insertion_point(field_set:chat.information.PRoomBatch.base_time)
+}
+
+// repeated bytes names = 2;
+inline int PRoomBatch::_internal_names_size() const {
+  return _impl_.names_.size();
+}
+inline int PRoomBatch::names_size() const {
+  return _internal_names_size();
+}
+inline void PRoomBatch::clear_names() {
+  _impl_.names_.Clear();
+}
+inline std::string* PRoomBatch::add_names() {
+  std::string* _s = _internal_add_names();
+  // @@protoc_insertion_point(field_add_mutable:chat.information.PRoomBatch.names)
+  return _s;
+}
+inline const std::string& PRoomBatch::_internal_names(int index) const {
+  return _impl_.names_.Get(index);
+}
+inline const std::string& PRoomBatch::names(int index) const {
+  // @@protoc_insertion_point(field_get:chat.information.PRoomBatch.names)
+  return _internal_names(index);
+}
+inline std::string* PRoomBatch::mutable_names(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.information.PRoomBatch.names)
+  return _impl_.names_.Mutable(index);
+}
+inline void PRoomBatch::set_names(int index, const std::string& value) {
+  _impl_.names_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:chat.information.PRoomBatch.names)
+}
+inline void PRoomBatch::set_names(int index, std::string&& value) {
+  _impl_.names_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:chat.information.PRoomBatch.names)
+}
+inline void PRoomBatch::set_names(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.names_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:chat.information.PRoomBatch.names)
+}
+inline void PRoomBatch::set_names(int index, const void* value, size_t size) {
+  _impl_.names_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:chat.information.PRoomBatch.names)
+}
+inline std::string* PRoomBatch::_internal_add_names() {
+  return _impl_.names_.Add();
+}
+inline void PRoomBatch::add_names(const std::string& value) {
+  _impl_.names_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:chat.information.PRoomBatch.names)
+}
+inline void PRoomBatch::add_names(std::string&& value) {
+  _impl_.names_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:chat.information.PRoomBatch.names)
+}
+inline void PRoomBatch::add_names(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.names_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:chat.information.PRoomBatch.names)
+}
+inline void PRoomBatch::add_names(const void* value, size_t size) {
+  _impl_.names_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:chat.information.PRoomBatch.names)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+PRoomBatch::names() const {
+  // @@protoc_insertion_point(field_list:chat.information.PRoomBatch.names)
+  return _impl_.names_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+PRoomBatch::mutable_names() {
+  // @@protoc_insertion_point(field_mutable_list:chat.information.PRoomBatch.names)
+  return &_impl_.names_;
+}
+
+// repeated .chat.information.PBatchRecord records = 3;
+inline int PRoomBatch::_internal_records_size() const {
+  return _impl_.records_.size();
+}
+inline int PRoomBatch::records_size() const {
+  return _internal_records_size();
+}
+inline void PRoomBatch::clear_records() {
+  _impl_.records_.Clear();
+}
+inline ::chat::information::PBatchRecord* PRoomBatch::mutable_records(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.information.PRoomBatch.records)
+  return _impl_.records_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::information::PBatchRecord >*
+PRoomBatch::mutable_records() {
+  // @@protoc_insertion_point(field_mutable_list:chat.information.PRoomBatch.records)
+  return &_impl_.records_;
+}
+inline const ::chat::information::PBatchRecord& PRoomBatch::_internal_records(int index) const {
+  return _impl_.records_.Get(index);
+}
+inline const ::chat::information::PBatchRecord& PRoomBatch::records(int index) const {
+  // @@protoc_insertion_point(field_get:chat.information.PRoomBatch.records)
+  return _internal_records(index);
+}
+inline ::chat::information::PBatchRecord* PRoomBatch::_internal_add_records() {
+  return _impl_.records_.Add();
+}
+inline ::chat::information::PBatchRecord* PRoomBatch::add_records() {
+  ::chat::information::PBatchRecord* _add = _internal_add_records();
+  // @@protoc_insertion_point(field_add:chat.information.PRoomBatch.records)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::information::PBatchRecord >&
+PRoomBatch::records() const {
+  // @@protoc_insertion_point(field_list:chat.information.PRoomBatch.records)
+  return _impl_.records_;
+}
+
+// -------------------------------------------------------------------
+
+// PServerErrorMessage
+
+// .chat.information.PServerErrorMessage.ErrorMessage mes = 1;
+inline void PServerErrorMessage::clear_mes() {
+  _impl_.mes_ = 0;
+}
+inline ::chat::information::PServerErrorMessage_ErrorMessage PServerErrorMessage::_internal_mes() const {
+  return static_cast< ::chat::information::PServerErrorMessage_ErrorMessage >(_impl_.mes_);
+}
+inline ::chat::information::PServerErrorMessage_ErrorMessage PServerErrorMessage::mes() const {
+  // @@protoc_insertion_point(field_get:chat.information.PServerErrorMessage.mes)
+  return _internal_mes();
+}
+inline void PServerErrorMessage::_internal_set_mes(::chat::information::PServerErrorMessage_ErrorMessage value) {
+  
+  _impl_.mes_ = value;
+}
+inline void PServerErrorMessage::set_mes(::chat::information::PServerErrorMessage_ErrorMessage value) {
+  _internal_set_mes(value);
+  // @@protoc_insertion_point(field_set:chat.information.PServerErrorMessage.mes)
+}
+
+// -------------------------------------------------------------------
+
+// PHello
+
+// uint32 features = 1;
+inline void PHello::clear_features() {
+  _impl_.features_ = 0u;
+}
+inline uint32_t PHello::_internal_features() const {
+  return _impl_.features_;
+}
+inline uint32_t PHello::features() const {
+  // @@protoc_insertion_point(field_get:chat.information.PHello.features)
+  return _internal_features();
+}
+inline void PHello::_internal_set_features(uint32_t value) {
+  
+  _impl_.features_ = value;
+}
+inline void PHello::set_features(uint32_t value) {
+  _internal_set_features(value);
+  // @@protoc_insertion_point(field_set:chat.information.PHello.features)
+}
+
+// -------------------------------------------------------------------
+
+// PJoinRoom
+
+// bytes room = 1;
+inline void PJoinRoom::clear_room() {
+  _impl_.room_.ClearToEmpty();
+}
+inline const std::string& PJoinRoom::room() const {
+  // @@protoc_insertion_point(field_get:chat.information.PJoinRoom.room)
+  return _internal_room();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PJoinRoom::set_room(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.room_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.information.PJoinRoom.room)
+}
+inline std::string* PJoinRoom::mutable_room() {
+  std::string* _s = _internal_mutable_room();
+  // @@protoc_insertion_point(field_mutable:chat.information.PJoinRoom.room)
+  return _s;
+}
+inline const std::string& PJoinRoom::_internal_room() const {
+  return _impl_.room_.Get();
+}
+inline void PJoinRoom::_internal_set_room(const std::string& value) {
+  
+  _impl_.room_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PJoinRoom::_internal_mutable_room() {
+  
+  return _impl_.room_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PJoinRoom::release_room() {
+  // @@protoc_insertion_point(field_release:chat.information.PJoinRoom.room)
+  return _impl_.room_.Release();
+}
+inline void PJoinRoom::set_allocated_room(std::string* room) {
+  if (room != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.room_.SetAllocated(room, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.room_.IsDefault()) {
+    _impl_.room_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.information.PJoinRoom.room)
+}
+
+// -------------------------------------------------------------------
+
+// PLeaveRoom
+
+// -------------------------------------------------------------------
+
+// PDirectMessage
+
+// bytes to = 1;
+inline void PDirectMessage::clear_to() {
+  _impl_.to_.ClearToEmpty();
 }
-inline ::google::protobuf::int64 PRoomInformation::time() const {
-  // @@protoc_insertion_point(field_get:chat.information.PRoomInformation.time)
-  return time_;
+inline const std::string& PDirectMessage::to() const {
+  // @@protoc_insertion_point(field_get:chat.information.PDirectMessage.to)
+  return _internal_to();
 }
-inline void PRoomInformation::set_time(::google::protobuf::int64 value) {
-  
-  time_ = value;
-  // @@protoc_insertion_point(field_set:chat.information.PRoomInformation.time)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PDirectMessage::set_to(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.to_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.information.PDirectMessage.to)
 }
-
-// bytes name = 2;
-inline void PRoomInformation::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline std::string* PDirectMessage::mutable_to() {
+  std::string* _s = _internal_mutable_to();
+  // @@protoc_insertion_point(field_mutable:chat.information.PDirectMessage.to)
+  return _s;
 }
-inline const ::std::string& PRoomInformation::name() const {
-  // @@protoc_insertion_point(field_get:chat.information.PRoomInformation.name)
-  return name_.GetNoArena();
+inline const std::string& PDirectMessage::_internal_to() const {
+  return _impl_.to_.Get();
 }
-inline void PRoomInformation::set_name(const ::std::string& value) {
+inline void PDirectMessage::_internal_set_to(const std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:chat.information.PRoomInformation.name)
+  _impl_.to_.Set(value, GetArenaForAllocation());
 }
-#if LANG_CXX11
-inline void PRoomInformation::set_name(::std::string&& value) {
+inline std::string* PDirectMessage::_internal_mutable_to() {
   
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:chat.information.PRoomInformation.name)
+  return _impl_.to_.Mutable(GetArenaForAllocation());
 }
-#endif
-inline void PRoomInformation::set_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
+inline std::string* PDirectMessage::release_to() {
+  // @@protoc_insertion_point(field_release:chat.information.PDirectMessage.to)
+  return _impl_.to_.Release();
+}
+inline void PDirectMessage::set_allocated_to(std::string* to) {
+  if (to != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.to_.SetAllocated(to, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.to_.IsDefault()) {
+    _impl_.to_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.information.PDirectMessage.to)
+}
+
+// bytes from = 2;
+inline void PDirectMessage::clear_from() {
+  _impl_.from_.ClearToEmpty();
+}
+inline const std::string& PDirectMessage::from() const {
+  // @@protoc_insertion_point(field_get:chat.information.PDirectMessage.from)
+  return _internal_from();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PDirectMessage::set_from(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.from_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.information.PDirectMessage.from)
+}
+inline std::string* PDirectMessage::mutable_from() {
+  std::string* _s = _internal_mutable_from();
+  // @@protoc_insertion_point(field_mutable:chat.information.PDirectMessage.from)
+  return _s;
+}
+inline const std::string& PDirectMessage::_internal_from() const {
+  return _impl_.from_.Get();
+}
+inline void PDirectMessage::_internal_set_from(const std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:chat.information.PRoomInformation.name)
+  _impl_.from_.Set(value, GetArenaForAllocation());
 }
-inline void PRoomInformation::set_name(const void* value, size_t size) {
+inline std::string* PDirectMessage::_internal_mutable_from() {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:chat.information.PRoomInformation.name)
+  return _impl_.from_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PDirectMessage::release_from() {
+  // @@protoc_insertion_point(field_release:chat.information.PDirectMessage.from)
+  return _impl_.from_.Release();
+}
+inline void PDirectMessage::set_allocated_from(std::string* from) {
+  if (from != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.from_.SetAllocated(from, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.from_.IsDefault()) {
+    _impl_.from_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.information.PDirectMessage.from)
 }
-inline ::std::string* PRoomInformation::mutable_name() {
+
+// bytes information = 3;
+inline void PDirectMessage::clear_information() {
+  _impl_.information_.ClearToEmpty();
+}
+inline const std::string& PDirectMessage::information() const {
+  // @@protoc_insertion_point(field_get:chat.information.PDirectMessage.information)
+  return _internal_information();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PDirectMessage::set_information(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.information_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.information.PDirectMessage.information)
+}
+inline std::string* PDirectMessage::mutable_information() {
+  std::string* _s = _internal_mutable_information();
+  // @@protoc_insertion_point(field_mutable:chat.information.PDirectMessage.information)
+  return _s;
+}
+inline const std::string& PDirectMessage::_internal_information() const {
+  return _impl_.information_.Get();
+}
+inline void PDirectMessage::_internal_set_information(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:chat.information.PRoomInformation.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.information_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PRoomInformation::release_name() {
-  // @@protoc_insertion_point(field_release:chat.information.PRoomInformation.name)
+inline std::string* PDirectMessage::_internal_mutable_information() {
   
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.information_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PDirectMessage::release_information() {
+  // @@protoc_insertion_point(field_release:chat.information.PDirectMessage.information)
+  return _impl_.information_.Release();
 }
-inline void PRoomInformation::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void PDirectMessage::set_allocated_information(std::string* information) {
+  if (information != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
-  // @@protoc_insertion_point(field_set_allocated:chat.information.PRoomInformation.name)
+  _impl_.information_.SetAllocated(information, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.information_.IsDefault()) {
+    _impl_.information_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.information.PDirectMessage.information)
 }
 
-// bytes information = 3;
-inline void PRoomInformation::clear_information() {
-  information_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// int64 time = 4;
+inline void PDirectMessage::clear_time() {
+  _impl_.time_ = int64_t{0};
 }
-inline const ::std::string& PRoomInformation::information() const {
-  // @@protoc_insertion_point(field_get:chat.information.PRoomInformation.information)
-  return information_.GetNoArena();
+inline int64_t PDirectMessage::_internal_time() const {
+  return _impl_.time_;
+}
+inline int64_t PDirectMessage::time() const {
+  // @@protoc_insertion_point(field_get:chat.information.PDirectMessage.time)
+  return _internal_time();
 }
-inline void PRoomInformation::set_information(const ::std::string& value) {
+inline void PDirectMessage::_internal_set_time(int64_t value) {
   
-  information_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:chat.information.PRoomInformation.information)
+  _impl_.time_ = value;
+}
+inline void PDirectMessage::set_time(int64_t value) {
+  _internal_set_time(value);
+  // @@protoc_insertion_point(field_set:chat.information.PDirectMessage.time)
+}
+
+// -------------------------------------------------------------------
+
+// PPresenceQuery
+
+// uint64 since_version = 1;
+inline void PPresenceQuery::clear_since_version() {
+  _impl_.since_version_ = uint64_t{0u};
+}
+inline uint64_t PPresenceQuery::_internal_since_version() const {
+  return _impl_.since_version_;
 }
-#if LANG_CXX11
-inline void PRoomInformation::set_information(::std::string&& value) {
+inline uint64_t PPresenceQuery::since_version() const {
+  // @@protoc_insertion_point(field_get:chat.information.PPresenceQuery.since_version)
+  return _internal_since_version();
+}
+inline void PPresenceQuery::_internal_set_since_version(uint64_t value) {
   
-  information_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:chat.information.PRoomInformation.information)
+  _impl_.since_version_ = value;
 }
-#endif
-inline void PRoomInformation::set_information(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
+inline void PPresenceQuery::set_since_version(uint64_t value) {
+  _internal_set_since_version(value);
+  // @@protoc_insertion_point(field_set:chat.information.PPresenceQuery.since_version)
+}
+
+// .chat.information.PPresenceQuery.Subscription subscription = 2;
+inline void PPresenceQuery::clear_subscription() {
+  _impl_.subscription_ = 0;
+}
+inline ::chat::information::PPresenceQuery_Subscription PPresenceQuery::_internal_subscription() const {
+  return static_cast< ::chat::information::PPresenceQuery_Subscription >(_impl_.subscription_);
+}
+inline ::chat::information::PPresenceQuery_Subscription PPresenceQuery::subscription() const {
+  // @@protoc_insertion_point(field_get:chat.information.PPresenceQuery.subscription)
+  return _internal_subscription();
+}
+inline void PPresenceQuery::_internal_set_subscription(::chat::information::PPresenceQuery_Subscription value) {
   
-  information_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:chat.information.PRoomInformation.information)
+  _impl_.subscription_ = value;
+}
+inline void PPresenceQuery::set_subscription(::chat::information::PPresenceQuery_Subscription value) {
+  _internal_set_subscription(value);
+  // @@protoc_insertion_point(field_set:chat.information.PPresenceQuery.subscription)
 }
-inline void PRoomInformation::set_information(const void* value, size_t size) {
+
+// -------------------------------------------------------------------
+
+// PPresenceMember
+
+// uint64 id = 1;
+inline void PPresenceMember::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+}
+inline uint64_t PPresenceMember::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t PPresenceMember::id() const {
+  // @@protoc_insertion_point(field_get:chat.information.PPresenceMember.id)
+  return _internal_id();
+}
+inline void PPresenceMember::_internal_set_id(uint64_t value) {
   
-  information_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:chat.information.PRoomInformation.information)
+  _impl_.id_ = value;
+}
+inline void PPresenceMember::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:chat.information.PPresenceMember.id)
 }
-inline ::std::string* PRoomInformation::mutable_information() {
+
+// bytes name = 2;
+inline void PPresenceMember::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& PPresenceMember::name() const {
+  // @@protoc_insertion_point(field_get:chat.information.PPresenceMember.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PPresenceMember::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.information.PPresenceMember.name)
+}
+inline std::string* PPresenceMember::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:chat.information.PPresenceMember.name)
+  return _s;
+}
+inline const std::string& PPresenceMember::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void PPresenceMember::_internal_set_name(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:chat.information.PRoomInformation.information)
-  return information_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PRoomInformation::release_information() {
-  // @@protoc_insertion_point(field_release:chat.information.PRoomInformation.information)
+inline std::string* PPresenceMember::_internal_mutable_name() {
   
-  return information_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PPresenceMember::release_name() {
+  // @@protoc_insertion_point(field_release:chat.information.PPresenceMember.name)
+  return _impl_.name_.Release();
 }
-inline void PRoomInformation::set_allocated_information(::std::string* information) {
-  if (information != NULL) {
+inline void PPresenceMember::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  information_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), information);
-  // @@protoc_insertion_point(field_set_allocated:chat.information.PRoomInformation.information)
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.information.PPresenceMember.name)
 }
 
 // -------------------------------------------------------------------
 
-// PServerErrorMessage
+// PPresenceDelta
 
-// .chat.information.PServerErrorMessage.ErrorMessage mes = 1;
-inline void PServerErrorMessage::clear_mes() {
-  mes_ = 0;
+// .chat.information.PPresenceDelta.Kind kind = 1;
+inline void PPresenceDelta::clear_kind() {
+  _impl_.kind_ = 0;
 }
-inline ::chat::information::PServerErrorMessage_ErrorMessage PServerErrorMessage::mes() const {
-  // @@protoc_insertion_point(field_get:chat.information.PServerErrorMessage.mes)
-  return static_cast< ::chat::information::PServerErrorMessage_ErrorMessage >(mes_);
+inline ::chat::information::PPresenceDelta_Kind PPresenceDelta::_internal_kind() const {
+  return static_cast< ::chat::information::PPresenceDelta_Kind >(_impl_.kind_);
 }
-inline void PServerErrorMessage::set_mes(::chat::information::PServerErrorMessage_ErrorMessage value) {
+inline ::chat::information::PPresenceDelta_Kind PPresenceDelta::kind() const {
+  // @@protoc_insertion_point(field_get:chat.information.PPresenceDelta.kind)
+  return _internal_kind();
+}
+inline void PPresenceDelta::_internal_set_kind(::chat::information::PPresenceDelta_Kind value) {
   
-  mes_ = value;
-  // @@protoc_insertion_point(field_set:chat.information.PServerErrorMessage.mes)
+  _impl_.kind_ = value;
+}
+inline void PPresenceDelta::set_kind(::chat::information::PPresenceDelta_Kind value) {
+  _internal_set_kind(value);
+  // @@protoc_insertion_point(field_set:chat.information.PPresenceDelta.kind)
+}
+
+// uint64 id = 2;
+inline void PPresenceDelta::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+}
+inline uint64_t PPresenceDelta::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t PPresenceDelta::id() const {
+  // @@protoc_insertion_point(field_get:chat.information.PPresenceDelta.id)
+  return _internal_id();
+}
+inline void PPresenceDelta::_internal_set_id(uint64_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void PPresenceDelta::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:chat.information.PPresenceDelta.id)
+}
+
+// bytes name = 3;
+inline void PPresenceDelta::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& PPresenceDelta::name() const {
+  // @@protoc_insertion_point(field_get:chat.information.PPresenceDelta.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PPresenceDelta::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.information.PPresenceDelta.name)
+}
+inline std::string* PPresenceDelta::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:chat.information.PPresenceDelta.name)
+  return _s;
+}
+inline const std::string& PPresenceDelta::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void PPresenceDelta::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PPresenceDelta::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PPresenceDelta::release_name() {
+  // @@protoc_insertion_point(field_release:chat.information.PPresenceDelta.name)
+  return _impl_.name_.Release();
+}
+inline void PPresenceDelta::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.information.PPresenceDelta.name)
+}
+
+// -------------------------------------------------------------------
+
+// PPresence
+
+// uint64 version = 1;
+inline void PPresence::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+}
+inline uint64_t PPresence::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t PPresence::version() const {
+  // @@protoc_insertion_point(field_get:chat.information.PPresence.version)
+  return _internal_version();
+}
+inline void PPresence::_internal_set_version(uint64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void PPresence::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:chat.information.PPresence.version)
+}
+
+// bool snapshot = 2;
+inline void PPresence::clear_snapshot() {
+  _impl_.snapshot_ = false;
+}
+inline bool PPresence::_internal_snapshot() const {
+  return _impl_.snapshot_;
+}
+inline bool PPresence::snapshot() const {
+  // @@protoc_insertion_point(field_get:chat.information.PPresence.snapshot)
+  return _internal_snapshot();
+}
+inline void PPresence::_internal_set_snapshot(bool value) {
+  
+  _impl_.snapshot_ = value;
+}
+inline void PPresence::set_snapshot(bool value) {
+  _internal_set_snapshot(value);
+  // @@protoc_insertion_point(field_set:chat.information.PPresence.snapshot)
+}
+
+// uint32 page = 3;
+inline void PPresence::clear_page() {
+  _impl_.page_ = 0u;
+}
+inline uint32_t PPresence::_internal_page() const {
+  return _impl_.page_;
+}
+inline uint32_t PPresence::page() const {
+  // @@protoc_insertion_point(field_get:chat.information.PPresence.page)
+  return _internal_page();
+}
+inline void PPresence::_internal_set_page(uint32_t value) {
+  
+  _impl_.page_ = value;
+}
+inline void PPresence::set_page(uint32_t value) {
+  _internal_set_page(value);
+  // @@protoc_insertion_point(field_set:chat.information.PPresence.page)
+}
+
+// bool last = 4;
+inline void PPresence::clear_last() {
+  _impl_.last_ = false;
+}
+inline bool PPresence::_internal_last() const {
+  return _impl_.last_;
+}
+inline bool PPresence::last() const {
+  // @@protoc_insertion_point(field_get:chat.information.PPresence.last)
+  return _internal_last();
+}
+inline void PPresence::_internal_set_last(bool value) {
+  
+  _impl_.last_ = value;
+}
+inline void PPresence::set_last(bool value) {
+  _internal_set_last(value);
+  // @@protoc_insertion_point(field_set:chat.information.PPresence.last)
+}
+
+// repeated .chat.information.PPresenceMember members = 5;
+inline int PPresence::_internal_members_size() const {
+  return _impl_.members_.size();
+}
+inline int PPresence::members_size() const {
+  return _internal_members_size();
+}
+inline void PPresence::clear_members() {
+  _impl_.members_.Clear();
+}
+inline ::chat::information::PPresenceMember* PPresence::mutable_members(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.information.PPresence.members)
+  return _impl_.members_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::information::PPresenceMember >*
+PPresence::mutable_members() {
+  // @@protoc_insertion_point(field_mutable_list:chat.information.PPresence.members)
+  return &_impl_.members_;
+}
+inline const ::chat::information::PPresenceMember& PPresence::_internal_members(int index) const {
+  return _impl_.members_.Get(index);
+}
+inline const ::chat::information::PPresenceMember& PPresence::members(int index) const {
+  // @@protoc_insertion_point(field_get:chat.information.PPresence.members)
+  return _internal_members(index);
+}
+inline ::chat::information::PPresenceMember* PPresence::_internal_add_members() {
+  return _impl_.members_.Add();
+}
+inline ::chat::information::PPresenceMember* PPresence::add_members() {
+  ::chat::information::PPresenceMember* _add = _internal_add_members();
+  // @@protoc_insertion_point(field_add:chat.information.PPresence.members)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::information::PPresenceMember >&
+PPresence::members() const {
+  // @@protoc_insertion_point(field_list:chat.information.PPresence.members)
+  return _impl_.members_;
+}
+
+// repeated .chat.information.PPresenceDelta deltas = 6;
+inline int PPresence::_internal_deltas_size() const {
+  return _impl_.deltas_.size();
+}
+inline int PPresence::deltas_size() const {
+  return _internal_deltas_size();
+}
+inline void PPresence::clear_deltas() {
+  _impl_.deltas_.Clear();
+}
+inline ::chat::information::PPresenceDelta* PPresence::mutable_deltas(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.information.PPresence.deltas)
+  return _impl_.deltas_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::information::PPresenceDelta >*
+PPresence::mutable_deltas() {
+  // @@protoc_insertion_point(field_mutable_list:chat.information.PPresence.deltas)
+  return &_impl_.deltas_;
+}
+inline const ::chat::information::PPresenceDelta& PPresence::_internal_deltas(int index) const {
+  return _impl_.deltas_.Get(index);
+}
+inline const ::chat::information::PPresenceDelta& PPresence::deltas(int index) const {
+  // @@protoc_insertion_point(field_get:chat.information.PPresence.deltas)
+  return _internal_deltas(index);
+}
+inline ::chat::information::PPresenceDelta* PPresence::_internal_add_deltas() {
+  return _impl_.deltas_.Add();
+}
+inline ::chat::information::PPresenceDelta* PPresence::add_deltas() {
+  ::chat::information::PPresenceDelta* _add = _internal_add_deltas();
+  // @@protoc_insertion_point(field_add:chat.information.PPresence.deltas)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::information::PPresenceDelta >&
+PPresence::deltas() const {
+  // @@protoc_insertion_point(field_list:chat.information.PPresence.deltas)
+  return _impl_.deltas_;
+}
+
+// -------------------------------------------------------------------
+
+// PHistoryQuery
+
+// uint64 before_seq = 1;
+inline void PHistoryQuery::clear_before_seq() {
+  _impl_.before_seq_ = uint64_t{0u};
+}
+inline uint64_t PHistoryQuery::_internal_before_seq() const {
+  return _impl_.before_seq_;
+}
+inline uint64_t PHistoryQuery::before_seq() const {
+  // @@protoc_insertion_point(field_get:chat.information.PHistoryQuery.before_seq)
+  return _internal_before_seq();
+}
+inline void PHistoryQuery::_internal_set_before_seq(uint64_t value) {
+  
+  _impl_.before_seq_ = value;
+}
+inline void PHistoryQuery::set_before_seq(uint64_t value) {
+  _internal_set_before_seq(value);
+  // @@protoc_insertion_point(field_set:chat.information.PHistoryQuery.before_seq)
+}
+
+// uint32 count = 2;
+inline void PHistoryQuery::clear_count() {
+  _impl_.count_ = 0u;
+}
+inline uint32_t PHistoryQuery::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint32_t PHistoryQuery::count() const {
+  // @@protoc_insertion_point(field_get:chat.information.PHistoryQuery.count)
+  return _internal_count();
+}
+inline void PHistoryQuery::_internal_set_count(uint32_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void PHistoryQuery::set_count(uint32_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:chat.information.PHistoryQuery.count)
+}
+
+// -------------------------------------------------------------------
+
+// PHistory
+
+// uint64 first_seq = 1;
+inline void PHistory::clear_first_seq() {
+  _impl_.first_seq_ = uint64_t{0u};
+}
+inline uint64_t PHistory::_internal_first_seq() const {
+  return _impl_.first_seq_;
+}
+inline uint64_t PHistory::first_seq() const {
+  // @@protoc_insertion_point(field_get:chat.information.PHistory.first_seq)
+  return _internal_first_seq();
+}
+inline void PHistory::_internal_set_first_seq(uint64_t value) {
+  
+  _impl_.first_seq_ = value;
+}
+inline void PHistory::set_first_seq(uint64_t value) {
+  _internal_set_first_seq(value);
+  // @@protoc_insertion_point(field_set:chat.information.PHistory.first_seq)
+}
+
+// uint32 count = 2;
+inline void PHistory::clear_count() {
+  _impl_.count_ = 0u;
+}
+inline uint32_t PHistory::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint32_t PHistory::count() const {
+  // @@protoc_insertion_point(field_get:chat.information.PHistory.count)
+  return _internal_count();
+}
+inline void PHistory::_internal_set_count(uint32_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void PHistory::set_count(uint32_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:chat.information.PHistory.count)
+}
+
+// uint32 bytes = 3;
+inline void PHistory::clear_bytes() {
+  _impl_.bytes_ = 0u;
+}
+inline uint32_t PHistory::_internal_bytes() const {
+  return _impl_.bytes_;
+}
+inline uint32_t PHistory::bytes() const {
+  // @@protoc_insertion_point(field_get:chat.information.PHistory.bytes)
+  return _internal_bytes();
+}
+inline void PHistory::_internal_set_bytes(uint32_t value) {
+  
+  _impl_.bytes_ = value;
+}
+inline void PHistory::set_bytes(uint32_t value) {
+  _internal_set_bytes(value);
+  // @@protoc_insertion_point(field_set:chat.information.PHistory.bytes)
+}
+
+// bool last = 4;
+inline void PHistory::clear_last() {
+  _impl_.last_ = false;
+}
+inline bool PHistory::_internal_last() const {
+  return _impl_.last_;
+}
+inline bool PHistory::last() const {
+  // @@protoc_insertion_point(field_get:chat.information.PHistory.last)
+  return _internal_last();
+}
+inline void PHistory::_internal_set_last(bool value) {
+  
+  _impl_.last_ = value;
+}
+inline void PHistory::set_last(bool value) {
+  _internal_set_last(value);
+  // @@protoc_insertion_point(field_set:chat.information.PHistory.last)
 }
 
 #ifdef __GNUC__
@@ -847,24 +4633,59 @@ inline void PServerErrorMessage::set_mes(::chat::information::PServerErrorMessag
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace information
 }  // namespace chat
 
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
 template <> struct is_proto_enum< ::chat::information::PServerErrorMessage_ErrorMessage> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::chat::information::PServerErrorMessage_ErrorMessage>() {
   return ::chat::information::PServerErrorMessage_ErrorMessage_descriptor();
 }
+template <> struct is_proto_enum< ::chat::information::PPresenceQuery_Subscription> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::chat::information::PPresenceQuery_Subscription>() {
+  return ::chat::information::PPresenceQuery_Subscription_descriptor();
+}
+template <> struct is_proto_enum< ::chat::information::PPresenceDelta_Kind> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::chat::information::PPresenceDelta_Kind>() {
+  return ::chat::information::PPresenceDelta_Kind_descriptor();
+}
 
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_INCLUDED_Protocal_2eproto
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_Protocal_2eproto
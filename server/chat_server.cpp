@@ -1,12 +1,26 @@
 #include "chat_message.hpp"
+#include "deflate_codec.hpp"
+#include "frame_decoder.hpp"
+#include "dense_registry.hpp"
+#include "handler_memory.hpp"
+#include "message_dispatch.hpp"
+#include "message_log.hpp"
 
 #include <boost/asio.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <deque>
 #include <list>
 #include <memory>
-#include <set>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <utility>
+#include <vector>
+
+#include <sys/sendfile.h>
+#include <unistd.h>
 
 using boost::asio::ip::tcp;
 using namespace chat::information;
@@ -14,11 +28,272 @@ using namespace messageDeal;
 
 //----------------------------------------------------------------------
 
+//一项里按顺序发的一部分：内存里的一块，或者日志段文件里的一截(span.segment不为空)
+//文件里的那截用sendfile从page cache直接发到socket，不用先读到用户态再写出去
+struct write_part {
+    std::string bytes;
+    log_span span;
+
+    std::size_t length() const { return span.segment ? span.length : bytes.size(); }
+};
+typedef std::vector<write_part> write_parts;
+
+//发送队列里的一项，要么是一帧，要么是预先拼好的连续多帧（join时的历史消息），
+//要么是按顺序发的几部分（翻历史消息的回复，中间是日志文件里的几截）
+//都是共享的只读数据，入队只是引用计数加一
+//compact的帧用紧凑帧头发，帧头和body是两块buffer；deflate的帧有压缩过的样子就发压缩过的
+//拼好的多帧已经是对应的格式了
+//frame存的是没压缩的那一帧，已经是这个session要的编码，打MT_BATCH的时候要读它里面的聊天消息
+struct write_item {
+    chat_frame_ptr frame;
+    std::shared_ptr<const std::string> block;
+    std::shared_ptr<const write_parts> parts;
+    std::size_t parts_length = 0;
+    std::size_t frames;  //这一项里有几帧
+    bool compact;
+    bool deflate;
+
+    write_item(const chat_frame_ptr& f, bool c, bool d)
+        : frame(f), frames(1), compact(c), deflate(d) {}
+    write_item(const std::shared_ptr<const std::string>& b, std::size_t n)
+        : block(b), frames(n), compact(false), deflate(false) {}
+    write_item(const std::shared_ptr<const write_parts>& p, std::size_t n)
+        : parts(p), frames(n), compact(false), deflate(false){
+            for (const auto& part: *parts)
+                parts_length += part.length();
+        }
+
+    //真正发出去的那一帧
+    const chat_message& wire() const {
+        return deflate && frame->deflated() ? *frame->deflated() : *frame;
+    }
+
+    //发出去的字节数
+    std::size_t length() const {
+        if (parts)
+            return parts_length;
+        if (!frame)
+            return block->size();
+        return compact ? wire().compact_length() : wire().length();
+    }
+
+    //这一项要占几块buffer，parts不能和别的项一起writev，单独发
+    std::size_t buffer_count() const { return frame && compact ? 2 : 1; }
+
+    void append_buffers(std::vector<boost::asio::const_buffer>& buffers) const {
+        if (!frame) {
+            buffers.push_back(boost::asio::buffer(block->data(), block->size()));
+            return;
+        }
+        const chat_message& out = wire();
+        if (compact) {
+            buffers.push_back(boost::asio::buffer(out.compact_header(), out.compact_header_length()));
+            buffers.push_back(boost::asio::buffer(out.body(), out.body_length()));
+        } else {
+            buffers.push_back(boost::asio::buffer(out.data(), out.length()));
+        }
+    }
+};
+
 //这里不用vector，
 //1 vector对首位删除慢
 //2 可能会迭代器失效
 //3 会有vector扩容的问题
-typedef std::deque<chat_message> chat_message_queue;
+typedef std::deque<write_item> chat_message_queue;
+
+//async_write会把buffer序列拷贝一份存到操作里面，直接传vector的话每次写都要分配一次
+//这里只传一个指向vector的视图，vector是session的成员，写完之前不会改
+class const_buffer_view {
+    public:
+        using value_type = boost::asio::const_buffer;
+        using const_iterator = std::vector<boost::asio::const_buffer>::const_iterator;
+
+        explicit const_buffer_view(const std::vector<boost::asio::const_buffer>& buffers)
+            : buffers_(&buffers) {}
+
+        const_iterator begin() const { return buffers_->begin(); }
+        const_iterator end() const { return buffers_->end(); }
+
+    private:
+        const std::vector<boost::asio::const_buffer>* buffers_;
+};
+
+//----------------------------------------------------------------------
+
+//历史消息的环形缓冲区，容量在构造的时候定好，满了以后新的覆盖最旧的
+//槽位是一块连续的数组，push不分配内存也不用像deque那样pop_front
+//数组随消息增长到容量为止，没人说过话的房间不占这块内存，只说过几句的也只占几个槽位
+class frame_ring {
+    public:
+        explicit frame_ring(std::size_t capacity)
+            : capacity_(capacity),
+            head_(0),
+            size_(0){
+            }
+
+        void push(const chat_frame_ptr& frame){
+            if (capacity_ == 0)
+                return;
+            //还没满的时候head_一直是0，直接接在后面
+            if (slots_.size() < capacity_) {
+                slots_.push_back(frame);
+                ++size_;
+                return;
+            }
+            //满了就覆盖最旧的
+            slots_[head_] = frame;
+            head_ = (head_ + 1) % slots_.size();
+        }
+
+        std::size_t size() const { return size_; }
+
+        //从旧到新
+        const chat_frame_ptr& operator[](std::size_t i) const {
+            return slots_[(head_ + i) % slots_.size()];
+        }
+
+    private:
+        std::vector<chat_frame_ptr> slots_;
+        std::size_t capacity_;
+        std::size_t head_;  //最旧的那一帧
+        std::size_t size_;
+};
+
+//----------------------------------------------------------------------
+
+//每个线程一个protobuf Arena，处理一条消息时用到的protobuf对象都在上面分配，
+//处理完Reset一下整块回收；初始块是线程自己的一块内存，够用的话就不会再malloc
+class message_arena {
+    public:
+        enum { initial_block_size = 16 * 1024 };
+
+        static google::protobuf::Arena& local(){
+            static thread_local message_arena arena;
+            return arena.arena_;
+        }
+
+        //离开作用域的时候Reset，超过初始块的话记一下
+        //可以嵌套（比如处理消息的时候直接写到了自己这个分片的session），只有最外层的才Reset
+        class scope {
+            public:
+                scope() : arena_(local()) { ++depth(); }
+                ~scope(){
+                    if (--depth() > 0)
+                        return;
+                    if (arena_.SpaceAllocated() > initial_block_size)
+                        overflows().fetch_add(1, std::memory_order_relaxed);
+                    arena_.Reset();
+                }
+                google::protobuf::Arena& arena() { return arena_; }
+            private:
+                google::protobuf::Arena& arena_;
+        };
+
+        static int& depth(){
+            static thread_local int value = 0;
+            return value;
+        }
+
+        //初始块不够用、arena去malloc了的次数
+        static std::atomic<std::uint64_t>& overflows(){
+            static std::atomic<std::uint64_t> count{0};
+            return count;
+        }
+
+    private:
+        message_arena()
+            : arena_(options()){
+            }
+
+        google::protobuf::ArenaOptions options(){
+            google::protobuf::ArenaOptions options;
+            options.initial_block = block_;
+            options.initial_block_size = sizeof(block_);
+            return options;
+        }
+
+        alignas(8) char block_[initial_block_size];
+        google::protobuf::Arena arena_;
+};
+
+//----------------------------------------------------------------------
+
+//服务器的一些计数，所有线程一起累加，只是用来观察，用relaxed就够了
+struct server_stats {
+    std::atomic<std::uint64_t> write_ops{0};       //聚合写的次数，每次一个async_write
+    std::atomic<std::uint64_t> frames_written{0};  //写出去的帧数
+    std::atomic<std::uint64_t> bytes_written{0};
+    std::atomic<std::uint64_t> batches{0};  //打成MT_BATCH的次数
+    std::atomic<std::uint64_t> sendfile_bytes{0};  //从日志文件直接发出去的字节数
+
+    //发送队列满了的时候的情况
+    std::atomic<long> sessions{0};             //当前的session数
+    std::atomic<long> sessions_congested{0};   //当前队列超过限制、还没有写空的session数
+    std::atomic<long> sessions_closing{0};     //因为太慢被断开、还没有析构的session数
+    std::atomic<std::uint64_t> frames_dropped{0};
+    std::atomic<std::uint64_t> snapshots{0};   //队列被替换成历史消息快照的次数
+
+    void print(std::ostream& os) const {
+        std::uint64_t writes = write_ops.load(std::memory_order_relaxed);
+        std::uint64_t frames = frames_written.load(std::memory_order_relaxed);
+        long total = sessions.load(std::memory_order_relaxed);
+        long congested = sessions_congested.load(std::memory_order_relaxed);
+        long closing = sessions_closing.load(std::memory_order_relaxed);
+        os << "[stats] writes " << writes
+            << " frames " << frames
+            << " bytes " << bytes_written.load(std::memory_order_relaxed)
+            << " frames/write " << (writes == 0 ? 0.0 : double(frames) / writes)
+            << " batches " << batches.load(std::memory_order_relaxed)
+            << " sendfile bytes " << sendfile_bytes.load(std::memory_order_relaxed)
+            << std::endl;
+        os << "[stats] sessions normal " << total - congested - closing
+            << " congested " << congested
+            << " closing " << closing
+            << " dropped " << frames_dropped.load(std::memory_order_relaxed)
+            << " snapshots " << snapshots.load(std::memory_order_relaxed)
+            << std::endl;
+        //mallocs不再增长就说明消息收发都是在复用池子里的内存
+        const buffer_pool_stats& pool = pool_stats();
+        os << "[stats] buffer pool hits " << pool.hits.load(std::memory_order_relaxed)
+            << " mallocs " << pool.mallocs.load(std::memory_order_relaxed)
+            << " frees " << pool.frees.load(std::memory_order_relaxed)
+            << " handler fallbacks " << handler_memory_fallbacks().load(std::memory_order_relaxed)
+            << " arena overflows " << message_arena::overflows().load(std::memory_order_relaxed)
+            << std::endl;
+        const message_log_stats& log = log_stats();
+        if (log.enabled.load(std::memory_order_relaxed)) {
+            std::uint64_t commits = log.commits.load(std::memory_order_relaxed);
+            std::uint64_t records = log.records.load(std::memory_order_relaxed);
+            os << "[stats] log records " << records
+                << " bytes " << log.bytes.load(std::memory_order_relaxed)
+                << " commits " << commits
+                << " records/commit " << (commits == 0 ? 0.0 : double(records) / commits)
+                << " pending " << log.pending.load(std::memory_order_relaxed)
+                << " failures " << log.failures.load(std::memory_order_relaxed)
+                << " open segments " << log.segments.load(std::memory_order_relaxed)
+                << std::endl;
+        }
+    }
+};
+
+static server_stats g_stats;
+
+//----------------------------------------------------------------------
+
+//每个session发送队列的上限，客户端不读的时候队列不能无限涨
+//0表示不限制；正在写的那一批不算在里面，也不会被丢掉
+struct session_limits {
+    enum overflow_policy {
+        drop_oldest,   //丢掉队列里最旧的，直到放得下
+        drop_newest,   //新来的直接丢掉
+        snapshot,      //整个队列换成room的历史消息快照，相当于让客户端重新同步
+        disconnect,    //直接断开，客户端重连以后会收到历史消息
+    };
+
+    std::size_t max_frames = 4096;
+    std::size_t max_bytes = 4 * 1024 * 1024;
+    overflow_policy policy = disconnect;
+};
 
 //----------------------------------------------------------------------
 
@@ -32,22 +307,475 @@ class chat_session;
 //using不用等号就会出现expected nested-name-specifier错误
 //shared_ptr头文件是<memory>
 using chat_session_ptr = std::shared_ptr<chat_session>;
+using session_handle = dense_registry<chat_session_ptr>::handle;
 //class chat_room; //这里不能这么写，因为这样写是不能生成实例的
 //前项声明会有问题
 
+//io_context池，有两种跑法：
+//1 pool模式：每个核跑一个io_context，每个io_context只在自己的线程上run
+//2 strand模式：只有一个io_context，N个线程一起调用run
+//不管哪种模式都有N个分片(shard)，每个分片是一个strand，新连接按照
+//轮询(round robin)或者当前负载分配到某一个分片上
+//同一个分片上的session和room里这个分片的数据只会在这个strand上被访问，
+//所以不用加锁；pool模式下strand只有一个线程在跑，基本没有额外开销
+class io_context_pool {
+    public:
+        using executor_type = boost::asio::strand<boost::asio::io_context::executor_type>;
+
+        enum balance_policy {
+            round_robin,  //轮流分配
+            least_load,   //分配给当前session最少的分片
+        };
+
+        enum run_mode {
+            one_context_per_thread,  //pool模式
+            shared_context,          //strand模式
+        };
+
+        io_context_pool(std::size_t pool_size, balance_policy policy, run_mode mode)
+            : policy_(policy),
+            next_(0),
+            loads_(new std::atomic<long>[pool_size]){
+                std::size_t contexts = mode == shared_context ? 1 : pool_size;
+                //pool模式下每个io_context只会在一个线程上跑，告诉asio不用考虑并发
+                int hint = mode == shared_context ? static_cast<int>(pool_size) : 1;
+                for (std::size_t i = 0; i < contexts; ++i) {
+                    io_contexts_.emplace_back(new boost::asio::io_context(hint));
+                    //没有事件的时候io_context也不能退出
+                    work_.emplace_back(boost::asio::make_work_guard(*io_contexts_.back()));
+                }
+                for (std::size_t i = 0; i < pool_size; ++i) {
+                    loads_[i] = 0;
+                    strands_.push_back(boost::asio::make_strand(get_io_context(i)));
+                }
+            }
+
+        io_context_pool(const io_context_pool&) = delete;
+        io_context_pool& operator=(const io_context_pool&) = delete;
+
+        //每个分片一个线程，第0个直接在调用线程上跑，阻塞到stop为止
+        void run(){
+            std::vector<std::thread> threads;
+            for (std::size_t i = 1; i < size(); ++i) {
+                boost::asio::io_context& ctx = get_io_context(i);
+                threads.emplace_back([&ctx](){ ctx.run(); });
+            }
+            get_io_context(0).run();
+            for (auto& t: threads)
+                t.join();
+        }
+
+        void stop(){
+            for (auto& ctx: io_contexts_)
+                ctx->stop();
+        }
+
+        //分片的个数，也就是线程数
+        std::size_t size() const { return strands_.size(); }
+
+        //分片所在的io_context，strand模式下都是同一个
+        boost::asio::io_context& get_io_context(std::size_t shard){
+            return *io_contexts_[shard % io_contexts_.size()];
+        }
+
+        executor_type get_executor(std::size_t shard){
+            return strands_[shard];
+        }
+
+        //给新连接选一个分片，并把负载计数加一，和release成对使用
+        std::size_t acquire(){
+            std::size_t shard = 0;
+            if (policy_ == least_load) {
+                long best = loads_[0].load(std::memory_order_relaxed);
+                for (std::size_t i = 1; i < size(); ++i) {
+                    long load = loads_[i].load(std::memory_order_relaxed);
+                    if (load < best) {
+                        best = load;
+                        shard = i;
+                    }
+                }
+            }else {
+                shard = next_.fetch_add(1, std::memory_order_relaxed) % size();
+            }
+            return acquire(shard);
+        }
+
+        //新连接已经确定在哪个分片上的时候用（比如SO_REUSEPORT每个分片一个acceptor）
+        std::size_t acquire(std::size_t shard){
+            loads_[shard].fetch_add(1, std::memory_order_relaxed);
+            return shard;
+        }
+
+        void release(std::size_t shard){
+            loads_[shard].fetch_sub(1, std::memory_order_relaxed);
+        }
+
+    private:
+        using work_guard = boost::asio::executor_work_guard<boost::asio::io_context::executor_type>;
+
+        balance_policy policy_;
+        std::atomic<std::size_t> next_;
+        //loads_要比io_contexts_先声明，析构io_context时还在的session会调用release
+        std::unique_ptr<std::atomic<long>[]> loads_;
+        std::vector<std::unique_ptr<boost::asio::io_context>> io_contexts_;
+        std::vector<work_guard> work_;
+        std::vector<executor_type> strands_;
+};
+
+//----------------------------------------------------------------------
+
+//聊天消息有两种编码：MT_ROOM_INFO(protobuf)和MT_ROOM_INFO_FLAT(平铺)，见message_codec.hpp
+//-c flat的时候room做的是平铺的帧，没协商FEATURE_FLAT的session(老客户端)要protobuf的，
+//有这种session的时候另一种编码的样子做帧的时候一起做好，挂在transcoded上
+
+//两种编码的聊天消息都读成flat_room_info，protobuf的要先解析到scratch里，视图指向scratch
+bool read_room_info(const chat_message& frame, PRoomInformation& scratch, flat_room_info& info){
+    if (frame.type() == MT_ROOM_INFO_FLAT)
+        return frame.decode<flat_codec>(info);
+    if (!frame.parseBody(scratch))
+        return false;
+    info.time = scratch.time();
+    info.name = scratch.name().data();
+    info.name_length = scratch.name().size();
+    info.information = scratch.information().data();
+    info.information_length = scratch.information().size();
+    return true;
+}
+
+//同一条消息换成另一种编码
+chat_frame_ptr transcode_room_info(const chat_message& frame, int level){
+    PRoomInformation scratch;
+    flat_room_info info;
+    if (!read_room_info(frame, scratch, info))
+        return chat_frame_ptr();
+    if (frame.type() == MT_ROOM_INFO)
+        return encode_frame<flat_codec>(MT_ROOM_INFO_FLAT, info, level);
+    scratch.set_time(info.time);
+    scratch.set_name(info.name, info.name_length);
+    scratch.set_information(info.information, info.information_length);
+    return make_frame(MT_ROOM_INFO, scratch, level);
+}
+
+//session要平铺的还是protobuf的，帧不是它要的那种就换成transcoded
+//做帧的时候还没有这种session(比如刚join)就只好现在转一次
+chat_frame_ptr frame_for_codec(const chat_frame_ptr& frame, bool flat, int level){
+    int type = frame->type();
+    if ((type != MT_ROOM_INFO && type != MT_ROOM_INFO_FLAT) || (type == MT_ROOM_INFO_FLAT) == flat)
+        return frame;
+    if (frame->transcoded())
+        return frame->transcoded();
+    chat_frame_ptr transcoded = transcode_room_info(*frame, level);
+    return transcoded ? transcoded : frame;
+}
+
+//翻历史消息的时候日志里读出来的一条，编码不是session要的那种就换一下，再按Header的样子接在out后面
+void append_record(std::string& out, const Header& header, const char* body, std::size_t length, bool flat){
+    bool is_flat = header.type == MT_ROOM_INFO_FLAT;
+    if ((header.type == MT_ROOM_INFO || is_flat) && is_flat != flat) {
+        chat_frame_ptr frame = frame_for_codec(make_frame(header.type, std::string(body, length)), flat, 0);
+        out.append(frame->data(), frame->length());
+        return;
+    }
+    out.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.append(body, length);
+}
+
+//----------------------------------------------------------------------
+
 //这里要把声明搞完整
-class chat_room {
+//room按io_context_pool的分片存session：每个分片的sessions_只在对应的strand上访问
+//recent_msgs_是所有分片共享的，用mutex保护
+//一个端口上可以有很多房间(见room_registry)，空房间要尽量小：分片的表等第一个人进来再分配
+class chat_room : public std::enable_shared_from_this<chat_room> {
     public:
+        //history是保留多少条历史消息，新加入的人会收到这些
+        //deflate_level是压缩级别，0表示不答应客户端压缩
+        //flat表示聊天消息按平铺格式做帧，客户端可以协商FEATURE_FLAT
+        //log不为空的时候消息还要落盘，日志里已有的最后history条先读进历史消息
+        chat_room(io_context_pool& pool, std::size_t history, int deflate_level, bool flat,
+                std::shared_ptr<room_log> log)
+            : pool_(pool),
+            log_(std::move(log)),
+            recent_msgs_(history),
+            last_seq_(0),
+            history_seq_(log_ ? log_->last_seq() : 0),
+            presence_log_(presence_log_size),
+            presence_version_(0),
+            deflate_level_(deflate_level),
+            deflate_sessions_(0),
+            flat_(flat),
+            legacy_sessions_(0){
+                if (log_ && history > 0) {
+                    std::uint64_t last = log_->last_seq();
+                    log_->read(last > history ? last - history + 1 : 1, history,
+                            [this](const Header& header, const char* body, std::size_t length){
+                                recent_msgs_.push(make_frame(header.type, std::string(body, length)));
+                            });
+                }
+            }
+
+        bool flat() const { return flat_; }
+        //平铺模式下有没有要protobuf帧的session，有的话做帧的时候两种都做
+        bool need_transcoded() const {
+            return flat_ && legacy_sessions_.load(std::memory_order_relaxed) > 0;
+        }
+
+        //客户端要压缩的时候答不答应
+        bool deflate_enabled() const { return deflate_level_ > 0; }
+        //新做的帧用多少级压缩，0表示不压缩
+        int frame_deflate_level() const {
+            return deflate_sessions_.load(std::memory_order_relaxed) > 0 ? deflate_level_ : 0;
+        }
+
         //这里不能写具体的名字
+        //join和leave要在session自己所在的strand上调用
         void join(chat_session_ptr);
-        void leave(chat_session_ptr);
-        void deliver(const chat_message&);
+        //session不在这个房间里(比如已经leave过了)返回false
+        bool leave(chat_session_ptr);
+        //deliver可以在任意线程上调用
+        void deliver(const chat_frame_ptr&);
+        //和deliver一样发给所有人，但是不进历史消息，大消息的分片用它
+        //后来的人只会收到半截的分片，客户端自己会扔掉
+        void relay(const chat_frame_ptr&);
+        //当前历史消息拼成的一整块，frames返回里面有几帧，没有历史消息的时候返回空
+        //compact表示拼成紧凑帧头的格式，deflate表示整块压缩成MT_DEFLATED帧，flat表示聊天消息用平铺格式
+        std::shared_ptr<const std::string> snapshot(std::size_t& frames, bool compact, bool deflate, bool flat);
+        //往前翻历史消息：序号在before之前的最多count条，先从recent_msgs_里拿，更早的去日志里找
+        //返回按顺序发的几部分：MT_HISTORY帧(按compact选帧头)，日志里的那几截，内存里的那几条
+        //消息都用Header，聊天消息按flat选编码；日志里的够多、编码也对的话是文件里的原样，不拷贝
+        //frames返回里面一共几帧
+        std::shared_ptr<const write_parts> history(std::uint64_t before, std::size_t count,
+                bool compact, bool flat, std::size_t& frames);
+        //删掉以后历史消息不会丢：没有历史消息，或者都已经写进日志了；room_registry清理没人用的房间的时候看它
+        bool disposable();
+
+        //名单(presence)：房间里每个人的id和名字，每次有人进出、改名版本号加一
+        //订阅了的session只收到变化，最近presence_log_size个变化留着，客户端断了几个版本可以只补这几个
+        //下面几个都要在session自己的strand上调用
+        void rename(const chat_session_ptr&);
+        void subscribe_presence(const chat_session_ptr&);
+        void unsubscribe_presence(const chat_session_ptr&);
+        //客户端手上是since这个版本，返回要发给它的帧：之后的变化，或者整个名单
+        std::vector<chat_frame_ptr> presence_since(std::uint64_t since);
     private:
-        std::set<chat_session_ptr> sessions_;
-        enum { max_recent_msgs = 100 };
-        chat_message_queue recent_msgs_;
+        enum { presence_log_size = 256 };
+        enum { max_presence_name = 255 };  //名单里的名字最多这么长，一个人怎么也能放进一帧
+        //翻一次最多这么多条，每次的代价是有上限的；最长的消息也不到默认的发送队列上限(-Q)的一半
+        enum { max_history_count = 1024 };
+        //日志里的那截至少这么大才用sendfile，太小的话拷一下和前后的一起写，比多几次系统调用便宜
+        enum { min_sendfile_bytes = 16 * 1024 };
+
+        struct shard {
+            dense_registry<chat_session_ptr> sessions_;
+            dense_registry<chat_session_ptr> subscribers_;  //订阅了名单变化的
+        };
+
+        //在每个分片自己的strand上调用一次f(分片下标)，当前就在那个strand里的话直接调用
+        template <typename Function>
+        void for_each_shard(Function f);
+        //每个分片投递一次
+        void fanout(const chat_frame_ptr& msg, std::uint64_t seq);
+        //在分片自己的strand上把消息发给这个分片里的所有session
+        void deliver_shard(std::size_t index, const chat_frame_ptr& msg, std::uint64_t seq);
+        //要在mutex_里面调用
+        const std::shared_ptr<const std::string>& backlog_locked(bool compact, bool deflate, bool flat);
+        //名单变了，版本号加一，返回这个变化的帧；要在mutex_里面调用
+        chat_frame_ptr presence_changed_locked(PPresenceDelta::Kind kind, std::uint64_t id, const std::string& name);
+        std::vector<chat_frame_ptr> presence_since_locked(std::uint64_t since);
+        //名单的变化发给所有订阅的session
+        void fanout_presence(const chat_frame_ptr& delta);
+
+        io_context_pool& pool_;
+        //房间的日志，没开-L的时候是空的；deliver在mutex_里交给它，日志里的顺序和recent_msgs_一样
+        const std::shared_ptr<room_log> log_;
+        //每个分片一个，第一次join的时候在mutex_里分配，之后不再变
+        std::unique_ptr<shard[]> shards_;
+        std::mutex mutex_;  //保护recent_msgs_、backlogs_、last_seq_和shards_的分配
+        frame_ring recent_msgs_;
+        //recent_msgs_拼成一整块的样子，join的时候一次写出去
+        //有新消息就作废，下一次join的时候再拼，重连高峰的时候大家共用这一块
+        //帧头两种格式、压缩不压缩、两种编码，一共八种，下标是compact + deflate * 2 + flat * 4
+        std::shared_ptr<const std::string> backlogs_[8];
+        std::uint64_t last_seq_;  //每条消息一个递增序号，防止join的时候重复发送
+        //进历史消息的最后一条的序号，从1开始，和日志里的序号一样；recent_msgs_里是最后的那几条
+        std::uint64_t history_seq_;
+        //下面这些名单的东西也在mutex_里
+        std::unordered_map<std::uint64_t, std::string> members_;  //session的id到名字
+        frame_ring presence_log_;  //最近的变化，每帧一个版本，最后一帧是presence_version_
+        std::uint64_t presence_version_;
+        //整个名单分好页的样子，名单变了就作废，要的时候再拼
+        std::shared_ptr<const std::vector<chat_frame_ptr>> presence_pages_;
+        const int deflate_level_;
+        std::atomic<std::size_t> deflate_sessions_;  //开了压缩的session数，没有的时候新的帧就不用压缩了
+        const bool flat_;
+        std::atomic<std::size_t> legacy_sessions_;  //平铺模式下不要平铺格式的session数
 };     
 
+template <typename Function>
+void chat_room::for_each_shard(Function f){
+    //投递的时候房间可能已经没人了，要拿着它
+    std::shared_ptr<chat_room> self(shared_from_this());
+    for (std::size_t i = 0; i < pool_.size(); ++i) {
+        if (pool_.get_executor(i).running_in_this_thread()) {
+            f(i);
+        }else {
+            boost::asio::post(pool_.get_executor(i), [self, i, f](){ f(i); });
+        }
+    }
+}
+
+//----------------------------------------------------------------------
+
+//一个端口上的所有房间，按名字哈希查找，O(1)
+//房间在第一次有人要进的时候才建；名字是空的那个是大厅，连上来的时候都在大厅里
+//session手里的shared_ptr就是在用这个房间的证明，只剩这里的一个引用、也没有历史消息
+//(或者历史消息都在日志里)的房间可以删掉，每次房间数翻倍的时候顺便清理一遍，均摊下来建房间还是O(1)
+class room_registry {
+    public:
+        enum { max_name_length = 64 };
+        enum { min_sweep_size = 1024 };
+
+        //log不为空的时候每个房间的日志放在log_prefix下面，目录名见log_name
+        room_registry(io_context_pool& pool, std::size_t history, int deflate_level, bool flat,
+                message_log* log, std::string log_prefix)
+            : pool_(pool),
+            history_(history),
+            deflate_level_(deflate_level),
+            flat_(flat),
+            log_(log),
+            log_prefix_(std::move(log_prefix)),
+            lobby_(create(std::string())),
+            sweep_at_(min_sweep_size){
+            }
+
+        const std::shared_ptr<chat_room>& lobby() const { return lobby_; }
+
+        //任意线程都可以调用；名字太长返回空
+        std::shared_ptr<chat_room> get(const std::string& name){
+            if (name.empty())
+                return lobby_;
+            if (name.size() > max_name_length)
+                return std::shared_ptr<chat_room>();
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                auto it = rooms_.find(name);
+                if (it != rooms_.end())
+                    return it->second;
+            }
+            //建房间要扫日志、读历史消息，在锁外面做；同时有人建了同一个房间的话用先放进去的那个，
+            //两个拿到的是同一个room_log，多建的这个没往里写过，直接扔掉
+            std::shared_ptr<chat_room> room = create(name);
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = rooms_.find(name);
+            if (it != rooms_.end())
+                return it->second;
+            if (rooms_.size() >= sweep_at_) {
+                sweep_locked();
+                sweep_at_ = std::max<std::size_t>(min_sweep_size, rooms_.size() * 2);
+            }
+            return rooms_.emplace(name, std::move(room)).first->second;
+        }
+
+    private:
+        //有日志的话建房间的时候打开它，目录里已有的段要扫一遍(同一个目录只扫一次)
+        std::shared_ptr<chat_room> create(const std::string& name){
+            std::shared_ptr<room_log> log;
+            if (log_)
+                log = log_->open(log_prefix_ + "/" + log_name(name));
+            return std::make_shared<chat_room>(pool_, history_, deflate_level_, flat_, std::move(log));
+        }
+
+        //房间名可以是任意字节，目录名用十六进制；大厅是lobby，不会和十六进制的撞上
+        static std::string log_name(const std::string& name){
+            if (name.empty())
+                return "lobby";
+            static const char digits[] = "0123456789abcdef";
+            std::string result;
+            result.reserve(name.size() * 2);
+            for (unsigned char c: name) {
+                result.push_back(digits[c >> 4]);
+                result.push_back(digits[c & 0xf]);
+            }
+            return result;
+        }
+
+        //use_count只能在拿着引用的线程上变大，这里看到1就说明没有别人在用了
+        void sweep_locked(){
+            for (auto it = rooms_.begin(); it != rooms_.end(); ) {
+                if (it->second.use_count() == 1 && it->second->disposable())
+                    it = rooms_.erase(it);
+                else
+                    ++it;
+            }
+        }
+
+        io_context_pool& pool_;
+        const std::size_t history_;
+        const int deflate_level_;
+        const bool flat_;
+        message_log* const log_;
+        const std::string log_prefix_;
+        const std::shared_ptr<chat_room> lobby_;
+        std::mutex mutex_;  //保护rooms_
+        std::unordered_map<std::string, std::shared_ptr<chat_room>> rooms_;
+        std::size_t sweep_at_;  //房间数到这么多的时候清理一次
+};
+
+//----------------------------------------------------------------------
+
+//绑定的名字到session的索引，私聊的时候按名字直接找到人，不用在房间里广播再过滤
+//按名字的哈希分成几段，每段一把锁，不同线程绑定、查找不同的名字基本不会抢同一把锁
+//同一个名字被几个连接绑定的时候，私聊发给最后绑定的那个
+//存的是weak_ptr，索引不延长session的生命周期
+class name_directory {
+    public:
+        enum { bucket_count = 16 };
+
+        //改名的时候先去掉旧名字；name为空就只是去掉
+        void bind(const std::string& old_name, const std::string& name, const chat_session_ptr& session){
+            remove(old_name, session);
+            if (name.empty())
+                return;
+            bucket& b = bucket_for(name);
+            std::lock_guard<std::mutex> lock(b.mutex);
+            b.sessions[name] = session;
+        }
+
+        //只去掉指向这个session的，名字已经被别人绑走了就不动
+        void remove(const std::string& name, const chat_session_ptr& session){
+            if (name.empty())
+                return;
+            bucket& b = bucket_for(name);
+            std::lock_guard<std::mutex> lock(b.mutex);
+            auto it = b.sessions.find(name);
+            if (it == b.sessions.end())
+                return;
+            chat_session_ptr current = it->second.lock();
+            if (!current || current == session)
+                b.sessions.erase(it);
+        }
+
+        //不在线返回空
+        chat_session_ptr find(const std::string& name){
+            bucket& b = bucket_for(name);
+            std::lock_guard<std::mutex> lock(b.mutex);
+            auto it = b.sessions.find(name);
+            return it == b.sessions.end() ? chat_session_ptr() : it->second.lock();
+        }
+
+    private:
+        struct bucket {
+            std::mutex mutex;
+            std::unordered_map<std::string, std::weak_ptr<chat_session>> sessions;
+        };
+
+        bucket& bucket_for(const std::string& name){
+            return buckets_[std::hash<std::string>()(name) % bucket_count];
+        }
+
+        bucket buckets_[bucket_count];
+};
+
 //----------------------------------------------------------------------
 
 //客户端连接进来作为一个session（事件）
@@ -59,22 +787,154 @@ class chat_room {
 //场景: 在类中发起一个异步操作, callback回来要保证发起操作的对象仍然有效.
 class chat_session : public std::enable_shared_from_this<chat_session>{
     public:
-        chat_session(tcp::socket socket, chat_room& room)
+        chat_session(tcp::socket socket, room_registry& rooms, name_directory& names,
+                io_context_pool& pool, std::size_t shard,
+                const session_limits& limits)
             : socket_(std::move(socket)),
-            room_(room){
+            hello_timer_(socket_.get_executor()),
+            read_timer_(socket_.get_executor()),
+            rooms_(rooms),
+            names_(names),
+            room_(rooms.lobby()),
+            pool_(pool),
+            shard_(shard),
+            limits_(limits),
+            id_(next_id()),
+            joined_seq_(0){
+                g_stats.sessions.fetch_add(1, std::memory_order_relaxed);
             }
 
+        ~chat_session(){
+            set_state(normal);
+            g_stats.sessions.fetch_sub(1, std::memory_order_relaxed);
+            pool_.release(shard_);
+        }
+
         void start(){
-            //这个shared_from_this()返回的是这个类本身的一个shared_ptr
-            //shared_ptr<chat_session>()
-            room_.join(shared_from_this());
             //这里其实已经成功连接进来了，之后就是接受服务器的消息了
-            do_read_header(); //读报文头部
+            do_read(); //读报文
+            //新版客户端连上就发MT_HELLO，等它到了再join，历史消息就能按协商好的格式(压缩过的)发
+            //老客户端不发hello，第一次读到数据或者等hello_wait_ms还没有消息就按原来的格式join
+            auto self(shared_from_this());
+            hello_timer_.expires_after(std::chrono::milliseconds(hello_wait_ms));
+            hello_timer_.async_wait([this, self](boost::system::error_code ec){
+                    if (!ec)
+                        join_room();
+                    });
+        }
+
+        void deliver(const chat_frame_ptr& msg){
+            if (state_ == closing)
+                return;
+            //等着发快照的时候新消息都会在快照里，不用再入队
+            if (snapshot_pending_) {
+                g_stats.frames_dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            enqueue(frame_for_codec(msg, flat_, room_->frame_deflate_level()));
+        }
+
+        //私聊不在房间的历史消息里，等着发快照的时候也要入队
+        //和deliver一样要在session自己的strand上调用
+        void deliver_direct(const chat_frame_ptr& msg){
+            if (state_ == closing)
+                return;
+            enqueue(msg);
+        }
+
+        //join的时候用，一整块历史消息当成一项入队
+        void deliver_backlog(const std::shared_ptr<const std::string>& block, std::size_t frames){
+            push(write_item(block, frames));
+        }
+
+        //现在发出去的帧用不用紧凑帧头、压不压缩，room拼历史消息的时候要按这个格式拼
+        bool compact() const { return compact_; }
+        bool deflate() const { return deflate_; }
+        bool flat() const { return flat_; }
+
+        std::string getName() { return m_name; }
+
+        std::size_t shard() const { return shard_; }
+
+        //在room分片登记表里的位置，leave的时候用
+        session_handle room_handle() const { return room_handle_; }
+        void set_room_handle(session_handle handle) { room_handle_ = handle; }
+
+        //名单里用的编号
+        std::uint64_t id() const { return id_; }
+        bool presence_subscribed() const { return presence_subscribed_; }
+        session_handle presence_handle() const { return presence_handle_; }
+        void set_presence_handle(session_handle handle) { presence_handle_ = handle; }
+
+        //名单的整页或者变化，和私聊一样不在历史消息里，等快照的时候也要入队
+        void deliver_presence(const std::vector<chat_frame_ptr>& frames){
+            for (const auto& frame: frames)
+                deliver_direct(frame);
+        }
+
+        //往前翻历史消息的时候没说从哪里开始，就从join的时候收到的历史消息的前面开始
+        void set_history_before(std::uint64_t seq) { history_before_ = seq; }
+
+        //join的时候已经补发到了哪一条消息，序号不大于它的广播不再重复发送
+        std::uint64_t joined_seq() const { return joined_seq_; }
+        void set_joined_seq(std::uint64_t seq) { joined_seq_ = seq; }
+
+    private:
+        enum pressure_state { normal, congested, closing };
+
+        void join_room(){
+            if (!waiting_hello_)
+                return;
+            waiting_hello_ = false;
+            hello_timer_.cancel();
+            //这个shared_from_this()返回的是这个类本身的一个shared_ptr
+            room_->join(shared_from_this());
+        }
+
+        //连接断了，读和写都出错的话会调用两次，还没join过的就不用去room里删
+        void leave_room(){
+            if (left_)
+                return;
+            left_ = true;
+            bool joined = !waiting_hello_;
+            waiting_hello_ = false;
+            hello_timer_.cancel();
+            read_timer_.cancel();
+            names_.remove(m_name, shared_from_this());
+            if (joined)
+                room_->leave(shared_from_this());
         }
 
-        void deliver(const chat_message& msg){
+        //每个session一个编号，用来区分不同人发的分片
+        static std::uint64_t next_id(){
+            static std::atomic<std::uint64_t> id{0};
+            return id.fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+
+        //状态变化的时候顺便维护g_stats里每种状态的session数
+        void set_state(pressure_state state){
+            if (state == state_)
+                return;
+            if (state_ == congested)
+                g_stats.sessions_congested.fetch_sub(1, std::memory_order_relaxed);
+            else if (state_ == closing)
+                g_stats.sessions_closing.fetch_sub(1, std::memory_order_relaxed);
+            if (state == congested)
+                g_stats.sessions_congested.fetch_add(1, std::memory_order_relaxed);
+            else if (state == closing)
+                g_stats.sessions_closing.fetch_add(1, std::memory_order_relaxed);
+            state_ = state;
+        }
+
+        //正在写的那一批的项数，队列不空的时候一定有一批在写
+        std::size_t in_flight() const {
+            return write_msgs_.empty() ? 0 : write_items_;
+        }
+
+        void push(write_item item){
             bool write_in_progress = !write_msgs_.empty();
-            write_msgs_.push_back(msg);
+            queued_bytes_ += item.length();
+            write_msgs_.push_back(std::move(item));
             //第一次为空，只有为空的时候才会调用do_write
             //这里是防止调用两次do write
             if (!write_in_progress){
@@ -82,133 +942,599 @@ class chat_session : public std::enable_shared_from_this<chat_session>{
             }
         }
 
-        std::string getName() { return m_name; }
+        //队列满了就按策略处理，make_room返回false就不用再入队了
+        void enqueue(const chat_frame_ptr& msg){
+            enqueue(write_item(msg, compact_, deflate_));
+        }
+
+        void enqueue(write_item item){
+            if (over_limit(item.length()) && !make_room(item.length()))
+                return;
+            push(std::move(item));
+        }
+
+        //再放一项length字节进来会不会超过限制
+        bool over_limit(std::size_t length) const {
+            std::size_t frames = write_msgs_.size() - in_flight();
+            return (limits_.max_frames != 0 && frames + 1 > limits_.max_frames)
+                || (limits_.max_bytes != 0 && queued_bytes_ + length > limits_.max_bytes);
+        }
+
+        //从还没开始写的第一项开始扔掉count项
+        void drop_pending(std::size_t count){
+            auto first = write_msgs_.begin() + in_flight();
+            for (auto it = first; it != first + count; ++it) {
+                queued_bytes_ -= it->length();
+                g_stats.frames_dropped.fetch_add(it->frames, std::memory_order_relaxed);
+            }
+            write_msgs_.erase(first, first + count);
+        }
+
+        //队列满了的处理，返回true表示腾出了位置，新的这一帧可以入队
+        bool make_room(std::size_t length){
+            set_state(congested);
+            switch (limits_.policy) {
+                case session_limits::drop_oldest:
+                    while (write_msgs_.size() > in_flight() && over_limit(length))
+                        drop_pending(1);
+                    if (!over_limit(length))
+                        return true;
+                    break;
+                case session_limits::drop_newest:
+                    break;
+                case session_limits::snapshot:
+                    //没写出去的都扔掉，等正在写的这一批写完再去拿room当时的快照
+                    //这样客户端一直跟不上的时候也只是每次写完拿一次快照
+                    //新的这一帧已经在room的历史消息里了，快照里就有它
+                    drop_pending(write_msgs_.size() - in_flight());
+                    snapshot_pending_ = true;
+                    if (write_msgs_.empty())
+                        deliver_snapshot();
+                    return false;
+                case session_limits::disconnect:
+                    //关掉socket，还没完成的读写都会出错返回，在回调里面leave
+                    //这里可能正在room的广播循环里面，不能直接leave
+                    set_state(closing);
+                    g_stats.frames_dropped.fetch_add(1, std::memory_order_relaxed);
+                    boost::system::error_code ignored;
+                    socket_.close(ignored);
+                    return false;
+            }
+            g_stats.frames_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        void deliver_snapshot(){
+            snapshot_pending_ = false;
+            g_stats.snapshots.fetch_add(1, std::memory_order_relaxed);
+            std::size_t frames = 0;
+            auto block = room_->snapshot(frames, compact_, deflate_, flat_);
+            if (block)
+                deliver_backlog(block, frames);
+        }
 
-    private:
         //这种函数要封装起来，这样以后就可以复用的，只需要修改接口就行了
         //RoomInformation这里是把数据都封装成RoomInformation格式
-        std::string buildRoomInfo() const {
+        //PRoomInformation在arena上分配，直接序列化进要广播的那一帧里面
+        //聊天内容是从PChat里swap过来的，不再拷贝一次
+        //平铺模式下名字和内容直接拷进帧里，不用再序列化；有老客户端的话再做一份protobuf的
+        chat_frame_ptr buildRoomInfo(google::protobuf::Arena& arena, std::string* information) const {
+            int level = room_->frame_deflate_level();
+            int64_t time = (int64_t)getTimeStamp();
+            if (room_->flat()) {
+                flat_room_info info{time, m_name.data(), m_name.size(), information->data(), information->size()};
+                auto frame = encode_frame<flat_codec>(MT_ROOM_INFO_FLAT, info, level);
+                if (room_->need_transcoded())
+                    frame->set_transcoded(transcode_room_info(*frame, level));
+                return frame;
+            }
             //下面是protobuf的做法:
-            PRoomInformation roomInfo;
-            roomInfo.set_name(m_name);
-            roomInfo.set_information(m_chatInformation);
-            roomInfo.set_time((int64_t)getTimeStamp()); 
-            std::string out;
-            bool ok = roomInfo.SerializeToString(&out);
-            if( !ok ) {
-                std::cout << "Serialize error! in buildRoomInfo method" << std::endl;
-                exit(1);
+            PRoomInformation* roomInfo = google::protobuf::Arena::CreateMessage<PRoomInformation>(&arena);
+            roomInfo->set_name(m_name);
+            roomInfo->mutable_information()->swap(*information);
+            roomInfo->set_time(time);
+            return make_frame(MT_ROOM_INFO, *roomInfo, level);
+        }
+
+        //服务器认的消息，type直接查表分发到下面对应的on_message
+        //要加一种客户端发上来的消息：message_dispatch.hpp里加message_traits，这里加type和一个on_message
+        using dispatcher = message_dispatcher<chat_session, MT_BIND_NAME, MT_CHAT_INFO, MT_HELLO, MT_CHUNK,
+              MT_JOIN_ROOM, MT_LEAVE_ROOM, MT_DIRECT, MT_PRESENCE_QUERY, MT_HISTORY_QUERY>;
+        friend dispatcher;
+
+        void on_message(PBindName& bindName, const frame_view&){
+            if (!left_)
+                names_.bind(m_name, bindName.name(), shared_from_this());
+            m_name = bindName.name();
+            std::cout << "绑定名字成功: " << m_name << std::endl;
+            //还没join的话join的时候名单里就是新名字
+            if (!waiting_hello_ && !left_)
+                room_->rename(shared_from_this());
+        }
+
+        //查名单，顺便订阅或者退订；还没join的时候先记下来，join的时候一起发
+        void on_message(PPresenceQuery& query, const frame_view&){
+            bool joined = !waiting_hello_ && !left_;
+            if (query.subscription() == PPresenceQuery::UNSUBSCRIBE) {
+                presence_subscribed_ = false;
+                if (joined)
+                    room_->unsubscribe_presence(shared_from_this());
+                return;
             }
-            return out;
+            if (query.subscription() == PPresenceQuery::SUBSCRIBE) {
+                presence_subscribed_ = true;
+                if (!joined)
+                    return;
+                room_->subscribe_presence(shared_from_this());
+            }
+            deliver_presence(room_->presence_since(query.since_version()));
+        }
 
+        //私聊：按名字找到对方，投递到对方所在的分片上，不经过房间
+        //对方不在线的话回一个MT_SERVER_ERROR
+        void on_message(PDirectMessage& direct, const frame_view&){
+            chat_session_ptr target = names_.find(direct.to());
+            if (!target) {
+                PServerErrorMessage error;
+                error.set_mes(PServerErrorMessage::UserNotFound);
+                deliver_direct(make_frame(MT_SERVER_ERROR, error));
+                return;
+            }
+            direct.set_from(m_name);
+            direct.set_time((int64_t)getTimeStamp());
+            if (direct.ByteSizeLong() > chat_message::body_max_length) {
+                std::cout << "私聊太长!! direct message fail" << std::endl;
+                return;
+            }
+            chat_frame_ptr frame = make_frame(MT_DIRECT, direct);
+            auto executor = pool_.get_executor(target->shard());
+            if (executor.running_in_this_thread()) {
+                target->deliver_direct(frame);
+            }else {
+                boost::asio::post(executor, [target, frame](){ target->deliver_direct(frame); });
+            }
         }
 
-        //把string序列化回protobuf message struct
-        bool fillProtobuf(::google::protobuf::Message* msg) {
-            bool ok = msg->ParseFromString(read_msg_.body());
-            return ok;
+        //把bindname和chatinformation封装成Proominformation，只编码这一次，后面所有人共享这一帧
+        //老客户端连上来的第一次读里可能就有聊天消息，这时候还没join，房间的分片表可能还没分配，先join
+        //(bindname、join这些在join之前也能处理，不用提前)
+        //加上名字和时间以后超过一帧的不转发，收的人那边会当成坏帧把连接断掉，回一个BodyTooLong让发的人自己拆分片
+        void on_message(PChat& chat, const frame_view&){
+            join_room();
+            chat_frame_ptr frame = buildRoomInfo(message_arena::local(), chat.mutable_information());
+            if (frame->body_length() > chat_message::body_max_length
+                    || (frame->transcoded() && frame->transcoded()->body_length() > chat_message::body_max_length)) {
+                PServerErrorMessage error;
+                error.set_mes(PServerErrorMessage::BodyTooLong);
+                deliver_direct(make_frame(MT_SERVER_ERROR, error));
+                return;
+            }
+            room_->deliver(frame);
         }
 
-        //handleMessage也是一样，把脏活封装起来
-        void handleMessage(){
-            //解析body里面的内容
-            if(read_msg_.type() == MT_BIND_NAME) {
-                //用protobuf处理
-                PBindName bindName;
-                if(fillProtobuf(&bindName)) {
-                    m_name = bindName.name();
-                    std::cout << "绑定名字成功: " << m_name << std::endl;
-                }else {
-                    std::cout << "序列化失败!! handleMessage fail" << std::endl;
-                }
-            }else if(read_msg_.type() == MT_CHAT_INFO) {
-                //下面是用protobuf处理的方式
-                PChat chat;
-                if(!fillProtobuf(&chat)) {
-                    std::cout << "序列化失败!! handleMessage fail" << std::endl;
-                    return ;
-                }
-                m_chatInformation = chat.information();
+        //客户端发过来想用的功能，答应下来的原样回一个MT_HELLO
+        //回复本身还是用Header发，客户端收到它以后才切换，所以之前已经在队列里的帧不受影响，
+        //之后发下去的都用紧凑帧头
+        //客户端在收到回复之前发的还是Header，它收到回复以后再发一次MT_HELLO(最后一个用Header的帧)，
+        //这里收到这第二次的时候才把decoder_切过去
+        void on_message(PHello& hello, const frame_view&){
+            if (negotiated_) {
+                if (compact_ && (hello.features() & FEATURE_COMPACT_HEADER))
+                    decoder_.set_compact(true);
+                return;
+            }
+            negotiated_ = true;
+            std::uint32_t supported = FEATURE_COMPACT_HEADER | FEATURE_BATCH;
+            //room按join时的样子统计开了压缩、要protobuf帧的session，已经join了再来的hello就不答应这两个
+            if (room_->deflate_enabled() && waiting_hello_)
+                supported |= FEATURE_DEFLATE;
+            if (room_->flat() && waiting_hello_)
+                supported |= FEATURE_FLAT;
+            std::uint32_t features = hello.features() & supported;
+            hello.set_features(features);
+            if (state_ != closing)
+                push(write_item(make_frame(MT_HELLO, hello), false, false));
+            if (features & FEATURE_COMPACT_HEADER)
+                compact_ = true;
+            if (features & FEATURE_DEFLATE)
+                deflate_ = true;
+            if (features & FEATURE_BATCH)
+                batch_ = true;
+            if (features & FEATURE_FLAT)
+                flat_ = true;
+        }
+
+        //大消息的一个分片，直接转发出去，服务器不攒整条消息
+        //id换成服务器分配的，高32位是session的编号，不同的人发的分片不会混在一起
+        void on_message(PChunk& chunk, const frame_view&){
+            if (chunk.data().size() > chat_message::chunk_max_data) {
+                std::cout << "分片不合法!! handleChunk fail" << std::endl;
+                return;
+            }
+            chunk.set_id((id_ << 32) | (chunk.id() & 0xffffffff));
+            chunk.set_name(m_name);
+            chunk.set_time((int64_t)getTimeStamp());
+            if (chunk.ByteSizeLong() > chat_message::body_max_length) {
+                std::cout << "分片太大!! handleChunk fail" << std::endl;
+                return;
+            }
+            join_room();
+            room_->relay(track_chunk(make_frame(MT_CHUNK, chunk, room_->frame_deflate_level())));
+        }
+
+        //转发出去的分片要等所有收的人都写完(或者丢掉)帧才析构，析构的时候还给发的人一个名额
+        //帧用aliasing构造挂在chunk_credit上，收的人那边还是当成普通的帧
+        struct chunk_credit {
+            chat_frame_ptr frame;
+            std::weak_ptr<chat_session> sender;
+
+            chunk_credit(chat_frame_ptr f, std::weak_ptr<chat_session> s)
+                : frame(std::move(f)), sender(std::move(s)) {}
+
+            ~chunk_credit(){
+                if (auto session = sender.lock())
+                    session->chunk_released();
+            }
+        };
+
+        chat_frame_ptr track_chunk(chat_frame_ptr frame){
+            chunks_in_flight_.fetch_add(1, std::memory_order_relaxed);
+            auto credit = std::make_shared<chunk_credit>(std::move(frame), shared_from_this());
+            return chat_frame_ptr(credit, credit->frame.get());
+        }
+
+        //在收的人的线程上调用；降到一半的时候让停下来的读接着读，要回到自己的strand上
+        void chunk_released(){
+            if (chunks_in_flight_.fetch_sub(1, std::memory_order_acq_rel) != max_chunks_in_flight / 2)
+                return;
+            auto self(shared_from_this());
+            boost::asio::post(socket_.get_executor(), [this, self](){ resume_read(); });
+        }
+
+        //发出去的分片还有太多没写完，先不读这个人的socket，让最慢的收的人决定发的速度
+        //收的人一直不读的话等chunk_stall_ms再读一次，这时候由他的发送队列上限(-Q)去处理
+        void pause_read(){
+            read_paused_ = true;
+            auto self(shared_from_this());
+            read_timer_.expires_after(std::chrono::milliseconds(chunk_stall_ms));
+            read_timer_.async_wait([this, self](boost::system::error_code ec){
+                    if (!ec)
+                        resume_read();
+                    });
+        }
+
+        void resume_read(){
+            if (!read_paused_ || left_)
+                return;
+            read_paused_ = false;
+            read_timer_.cancel();
+            do_read();
+        }
 
-                //把bindname和chatinformation封装成Proominformation之后转成string
-                auto rinfo = buildRoomInfo();
+        //往前翻历史消息，回复和后面跟着的消息是一整项，队列满了丢的时候也是一起丢
+        void on_message(PHistoryQuery& query, const frame_view&){
+            join_room();
+            if (state_ == closing)
+                return;
+            std::uint64_t before = query.before_seq() != 0 ? query.before_seq() : history_before_;
+            std::size_t frames = 0;
+            auto parts = room_->history(before, query.count(), compact_, flat_, frames);
+            //和广播一样受-q/-Q限制，不读的客户端一直翻历史也不能让队列无限涨
+            enqueue(write_item(parts, frames));
+        }
 
-                chat_message msg;
-                msg.setMessage(MT_ROOM_INFO, rinfo);
-                room_.deliver(msg);
-            }else{
-                //啥都不做 
+        //换房间：先离开现在的，再进新的，新房间的历史消息会像刚连上的时候一样发下来
+        //还在等hello、没有join过的时候只换一下，等join_room的时候再进
+        void on_message(PJoinRoom& join, const frame_view&){
+            std::shared_ptr<chat_room> room = rooms_.get(join.room());
+            if (!room) {
+                std::cout << "房间名字太长!! join room fail" << std::endl;
+                return;
             }
+            switch_room(std::move(room));
         }
 
-        void do_read_header(){
+        void on_message(PLeaveRoom&, const frame_view&){
+            switch_room(rooms_.lobby());
+        }
+
+        void switch_room(std::shared_ptr<chat_room> room){
+            if (room == room_ || left_)
+                return;
+            if (!waiting_hello_)
+                room_->leave(shared_from_this());
+            room_ = std::move(room);
+            if (!waiting_hello_)
+                room_->join(shared_from_this());
+        }
+
+        void on_parse_error(const frame_view& frame){
+            std::cout << "序列化失败!! handleMessage fail, type is " << frame.type << std::endl;
+        }
+
+        //handleMessage也是一样，把脏活封装起来
+        //这里用到的protobuf对象都在线程的arena上，函数返回的时候一起回收
+        //不认识的type啥都不做
+        void handleMessage(const frame_view& frame){
+            message_arena::scope scope;
+            dispatcher::dispatch(*this, frame, &scope.arena());
+        }
+
+        //读的时候有多少读多少，读进来的数据里有几帧完整的就处理几帧，
+        //不完整的半帧留在decoder_里等下一次读
+        void do_read(){
             //这里为了不被析构，所以搞了个这个内容
             std::shared_ptr<chat_session> self(shared_from_this());
-            //auto self(shared_from_this());
-            read_msg_.resize(chat_message::header_length);
-            //之后异步的去读
-            boost::asio::async_read(socket_,
-                    //把头四个字节读到buff里面去
-                    boost::asio::buffer(read_msg_.data(), chat_message::header_length),
-                    //第三个参数是一个函数指针，也就是一个回调函数
-                    [this, self](boost::system::error_code ec, std::size_t /*length*/)
-                    {   //ec是error_code也就是模块或者系统错误，而且头部信息合法
-                        //body长度小于512
-                        if (!ec && read_msg_.decode_header()){
-                            self->do_read_body();
+            socket_.async_read_some(
+                    boost::asio::buffer(decoder_.write_data(), decoder_.write_space()),
+                    //回调用的内存从read_handler_memory_里拿，每次读都复用
+                    make_custom_alloc_handler(read_handler_memory_,
+                    [this, self](boost::system::error_code ec, std::size_t length)
+                    {
+                        if (ec) {
+                            //出错就断开，这里智能指针引用计数为0
+                            leave_room();
+                            return;
                         }
-                        else
-                        {   //出错就断开，这里智能指针引用计数为0
-                            room_.leave(shared_from_this());
+                        decoder_.commit(length);
+                        frame_view frame;
+                        frame_decoder::result result;
+                        while ((result = decoder_.next(frame)) == frame_decoder::frame_ready)
+                            handleMessage(frame);
+                        if (result == frame_decoder::bad_frame) {
+                            //header不合法，后面的数据也没法对齐了，直接断开
+                            leave_room();
+                            return;
                         }
-                    });
+                        //hello要是在，已经在上面处理过了
+                        join_room();
+                        if (chunks_in_flight_.load(std::memory_order_acquire) >= max_chunks_in_flight)
+                            pause_read();
+                        else
+                            do_read();
+                    }));
         }
 
-        void do_read_body(){
-            //这里的目的和上面一样
-            auto self(shared_from_this());
-            read_msg_.resize(chat_message::header_length + read_msg_.body_length());
-            boost::asio::async_read(socket_,
-                    //也是一样，把body的内容读到buff里面，错位了四个字节
-                    boost::asio::buffer(read_msg_.body(), read_msg_.body_length()),
-                    [this, self](boost::system::error_code ec, std::size_t /*length*/){
-                        if (!ec){
-                            //handleMessage负责处理body里面的内容，处理完以后继续异步读header
-                            handleMessage();
-                            do_read_header();
-                        }
-                        else{
-                            room_.leave(shared_from_this());
-                        }
-                    });
+        //队列最前面积压了好几条聊天消息的时候打成一个MT_BATCH：名字只发一次，时间只发差值，
+        //客户端一次就处理完；只合并连续的MT_ROOM_INFO，顺序不变，打出来的一帧不超过body_max_length
+        //只在do_write里调用，这时候队列里没有正在写的
+        void coalesce(){
+            std::size_t count = 0;
+            while (count < write_msgs_.size() && count < max_batch_records && write_msgs_[count].frame
+                    && (write_msgs_[count].frame->type() == MT_ROOM_INFO
+                        || write_msgs_[count].frame->type() == MT_ROOM_INFO_FLAT))
+                ++count;
+            if (count < 2)
+                return;
+            message_arena::scope scope;
+            google::protobuf::Arena& arena = scope.arena();
+            PRoomBatch* batch = google::protobuf::Arena::CreateMessage<PRoomBatch>(&arena);
+            //平铺格式的直接在帧上读，protobuf的解析到scratch里
+            PRoomInformation* scratch = google::protobuf::Arena::CreateMessage<PRoomInformation>(&arena);
+            flat_room_info info;
+            std::int64_t last_time = 0;
+            std::size_t used = 0;
+            for (; used < count; ++used) {
+                if (!read_room_info(*write_msgs_[used].frame, *scratch, info))
+                    break;
+                if (used == 0) {
+                    batch->set_base_time(info.time);
+                    last_time = info.time;
+                }
+                int name_index = 0;
+                while (name_index < batch->names_size()
+                        && batch->names(name_index).compare(0, std::string::npos, info.name, info.name_length) != 0)
+                    ++name_index;
+                bool new_name = name_index == batch->names_size();
+                if (new_name)
+                    batch->add_names()->assign(info.name, info.name_length);
+                PBatchRecord* record = batch->add_records();
+                record->set_name_index(name_index);
+                record->set_time_delta(info.time - last_time);
+                record->set_information(info.information, info.information_length);
+                if (batch->ByteSizeLong() > chat_message::body_max_length) {
+                    batch->mutable_records()->RemoveLast();
+                    if (new_name)
+                        batch->mutable_names()->RemoveLast();
+                    break;
+                }
+                last_time = info.time;
+            }
+            if (used < 2)
+                return;
+            write_item item(make_frame(MT_BATCH, *batch, deflate_ ? room_->frame_deflate_level() : 0),
+                    compact_, deflate_);
+            item.frames = used;
+            for (std::size_t i = 0; i < used; ++i)
+                queued_bytes_ -= write_msgs_[i].length();
+            queued_bytes_ += item.length();
+            write_msgs_.erase(write_msgs_.begin(), write_msgs_.begin() + used);
+            write_msgs_.push_front(std::move(item));
+            g_stats.batches.fetch_add(1, std::memory_order_relaxed);
         }
 
         //写write_msgs_里面的信息，相当于把chat_message消息都发出去
+        //队列里积压了多条的时候一次把它们都交给async_write（writev），
+        //不超过max_write_buffers块和max_write_bytes字节，写完以后再一起出队
         void do_write(){
             auto self(shared_from_this());
-            boost::asio::async_write(socket_,
-                    boost::asio::buffer(write_msgs_.front().data(), write_msgs_.front().length()),
-                    [this, self](boost::system::error_code ec, std::size_t /*length*/){
+            if (batch_)
+                coalesce();
+            write_buffers_.clear();
+            std::size_t bytes = 0;
+            write_items_ = 0;
+            write_frames_ = 0;
+            //最前面是分几部分发的一项，就单独发它
+            if (write_msgs_.front().parts) {
+                write_items_ = 1;
+                write_frames_ = write_msgs_.front().frames;
+                part_ = 0;
+                part_sent_ = 0;
+                write_next_part();
+                return;
+            }
+            for (const auto& item: write_msgs_) {
+                //分几部分发的一项不能放进writev，写到它前面为止
+                if (item.parts)
+                    break;
+                //第一项不管多大都要写
+                if (!write_buffers_.empty()
+                        && (write_buffers_.size() + item.buffer_count() > max_write_buffers
+                            || bytes + item.length() > max_write_bytes))
+                    break;
+                item.append_buffers(write_buffers_);
+                bytes += item.length();
+                ++write_items_;
+                write_frames_ += item.frames;
+            }
+            boost::asio::async_write(socket_, const_buffer_view(write_buffers_),
+                    make_custom_alloc_handler(write_handler_memory_,
+                    [this, self](boost::system::error_code ec, std::size_t length){
                         if (!ec)
-                        { //头部信息写完了，就检查是不是空的
-                            write_msgs_.pop_front();
-                            if (!write_msgs_.empty())
-                            { //继续写
-                                do_write();
-                            }
-                        }
-                        else{
-                            room_.leave(shared_from_this());
+                            write_done(length);
+                        else
+                            leave_room();
+                    }));
+        }
+
+        //这一批写完了，出队，再看队列是不是空的
+        void write_done(std::size_t length){
+            g_stats.write_ops.fetch_add(1, std::memory_order_relaxed);
+            g_stats.frames_written.fetch_add(write_frames_, std::memory_order_relaxed);
+            g_stats.bytes_written.fetch_add(length, std::memory_order_relaxed);
+            queued_bytes_ -= length;
+            write_msgs_.erase(write_msgs_.begin(), write_msgs_.begin() + write_items_);
+            if (!write_msgs_.empty())
+            { //继续写
+                do_write();
+            }
+            else if (snapshot_pending_)
+            { //deliver_snapshot里面会开始写
+                deliver_snapshot();
+            }
+            else if (state_ == congested)
+            { //队列写空了就说明客户端跟上了
+                set_state(normal);
+            }
+        }
+
+        //发队列最前面那一项的第part_部分，发完一部分接着发下一部分，都发完了和一批写完一样收尾
+        //后来的帧排在这一项后面，等它整个发完才轮到，不会插到中间去
+        void write_next_part(){
+            const write_item& item = write_msgs_.front();
+            if (part_ == item.parts->size()) {
+                write_done(item.length());
+                return;
+            }
+            const write_part& part = (*item.parts)[part_];
+            if (part.span.segment) {
+                send_span();
+                return;
+            }
+            auto self(shared_from_this());
+            boost::asio::async_write(socket_, boost::asio::buffer(part.bytes),
+                    make_custom_alloc_handler(write_handler_memory_,
+                    [this, self](boost::system::error_code ec, std::size_t){
+                        if (ec) {
+                            leave_room();
+                            return;
                         }
-                    });
+                        ++part_;
+                        write_next_part();
+                    }));
+        }
+
+        //日志文件里的一截用sendfile直接从page cache发到socket
+        //socket是非阻塞的，发不动了就等它可写再从part_sent_接着发
+        void send_span(){
+            const log_span& span = (*write_msgs_.front().parts)[part_].span;
+            boost::system::error_code ec;
+            if (!socket_.native_non_blocking())
+                socket_.native_non_blocking(true, ec);
+            while (!ec && part_sent_ < span.length) {
+                off_t offset = static_cast<off_t>(span.offset + part_sent_);
+                ssize_t sent = ::sendfile(socket_.native_handle(), span.segment->fd(), &offset, span.length - part_sent_);
+                if (sent > 0) {
+                    part_sent_ += sent;
+                    g_stats.sendfile_bytes.fetch_add(sent, std::memory_order_relaxed);
+                    continue;
+                }
+                if (sent < 0 && errno == EINTR)
+                    continue;
+                if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                    auto self(shared_from_this());
+                    socket_.async_wait(tcp::socket::wait_write,
+                            make_custom_alloc_handler(write_handler_memory_,
+                            [this, self](boost::system::error_code ec){
+                                if (ec)
+                                    leave_room();
+                                else
+                                    send_span();
+                            }));
+                    return;
+                }
+                //出错了，或者文件比记下来的短；已经发了半截，后面的帧对不齐了，只能断开
+                ec = boost::asio::error::broken_pipe;
+            }
+            if (ec) {
+                boost::system::error_code ignored;
+                socket_.close(ignored);
+                leave_room();
+                return;
+            }
+            ++part_;
+            part_sent_ = 0;
+            write_next_part();
         }
 
         tcp::socket socket_;
-        chat_room& room_; //这里肯定是room的生命周期更长
+        boost::asio::steady_timer hello_timer_;  //等MT_HELLO的超时
+        enum { hello_wait_ms = 200 };
+        boost::asio::steady_timer read_timer_;  //因为分片没写完停下来读的时候，最多停这么久
+        enum { chunk_stall_ms = 2000 };
+        //转发出去、还有人没写完的分片数，超过了就先不读，每个人的发送队列里最多积压这么多片
+        enum { max_chunks_in_flight = 16 };
+        std::atomic<int> chunks_in_flight_{0};
+        bool read_paused_ = false;
+        bool waiting_hello_ = true;  //还没join，这时候room里没有它
+        bool left_ = false;  //连接断了，已经离开了房间
+        room_registry& rooms_;  //这个端口上的所有房间
+        name_directory& names_;  //这个端口上绑定的名字，私聊用
+        std::shared_ptr<chat_room> room_;  //现在在的房间，连上来的时候是大厅
+        io_context_pool& pool_;
+        std::size_t shard_;  //所在的分片，socket和所有回调都跑在这个分片的strand上
+        const session_limits& limits_;
+        const std::uint64_t id_;
+        session_handle room_handle_;
+        session_handle presence_handle_;  //在房间订阅名单的表里的位置
+        bool presence_subscribed_ = false;  //订阅了名单的变化，换房间的时候跟着过去
+        pressure_state state_ = normal;
+        bool snapshot_pending_ = false;  //写完正在写的这一批以后要发一次历史消息快照
+        std::size_t queued_bytes_ = 0;  //write_msgs_里一共多少字节，包括正在写的
+        std::uint64_t joined_seq_;
+        std::uint64_t history_before_ = 0;  //往前翻历史消息的默认起点
         std::string m_name;  //这里是这个session的名字
-        std::string m_chatInformation;  
-        chat_message read_msg_;
+        bool negotiated_ = false;  //已经回过MT_HELLO了
+        bool compact_ = false;  //协商过紧凑帧头以后发下去的帧都用它
+        bool deflate_ = false;  //协商过压缩以后发下去的帧能压缩的都压缩
+        bool batch_ = false;  //协商过以后积压的消息打成MT_BATCH发
+        bool flat_ = false;  //协商过以后聊天消息用平铺格式发
+        frame_decoder decoder_;  //接收缓冲区，一次读进来的多帧在这里拆开
         chat_message_queue write_msgs_;
+        //asio一次writev最多64块，和它保持一致
+        enum { max_write_buffers = 64 };
+        enum { max_batch_records = 64 };
+        enum { max_write_bytes = 64 * 1024 };
+        //正在写的这一批的buffer，成员变量复用，不用每次分配
+        std::vector<boost::asio::const_buffer> write_buffers_;
+        std::size_t write_items_ = 0;  //这一批是队列里的前几项
+        std::size_t write_frames_ = 0;  //这一批一共几帧，统计用
+        std::size_t part_ = 0;  //分几部分发的那一项正在发第几部分
+        std::size_t part_sent_ = 0;  //日志文件里的那一截已经发了多少字节
+        //读和写同一时间各只有一个在进行，各留一块给asio放回调
+        //写操作里面带了64块buffer的数组，所以写的那块要大一些
+        handler_memory<256> read_handler_memory_;
+        handler_memory<2048> write_handler_memory_;
 };
 
 //----------------------------------------------------------------------
@@ -216,13 +1542,284 @@ class chat_session : public std::enable_shared_from_this<chat_session>{
 //chat_room函数实现
 void chat_room::join(chat_session_ptr session)
 {
-    sessions_.insert(session);
+    //在锁里面拿到拼好的历史消息，发送放到锁外面
+    std::shared_ptr<const std::string> backlog;
+    std::size_t frames;
+    chat_frame_ptr delta;
+    std::vector<chat_frame_ptr> presence;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!shards_)
+            shards_.reset(new shard[pool_.size()]);
+        frames = recent_msgs_.size();
+        backlog = backlog_locked(session->compact(), session->deflate(), session->flat());
+        session->set_joined_seq(last_seq_);
+        //往前翻从这次发下去的历史消息的前面开始
+        session->set_history_before(history_seq_ + 1 - recent_msgs_.size());
+        std::string& name = members_[session->id()];
+        name = session->getName().substr(0, max_presence_name);
+        delta = presence_changed_locked(PPresenceDelta::JOIN, session->id(), name);
+        //订阅过的换了房间，名单也换成这个房间的
+        if (session->presence_subscribed())
+            presence = presence_since_locked(0);
+    }
+    if (session->deflate())
+        deflate_sessions_.fetch_add(1, std::memory_order_relaxed);
+    if (flat_ && !session->flat())
+        legacy_sessions_.fetch_add(1, std::memory_order_relaxed);
+    session->set_room_handle(shards_[session->shard()].sessions_.insert(session));
     std::cout << "one client join the room" << std::endl;
-    for (const auto& msg: recent_msgs_)
-        session->deliver(msg);
+    if (backlog)
+        session->deliver_backlog(backlog, frames);
+    //自己进来的这个变化已经在名单里了，版本号不比名单的大，客户端会忽略
+    fanout_presence(delta);
+    if (session->presence_subscribed()) {
+        subscribe_presence(session);
+        session->deliver_presence(presence);
+    }
+}
+
+void chat_room::rename(const chat_session_ptr& session){
+    chat_frame_ptr delta;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = members_.find(session->id());
+        if (it == members_.end())
+            return;
+        it->second = session->getName().substr(0, max_presence_name);
+        delta = presence_changed_locked(PPresenceDelta::RENAME, session->id(), it->second);
+    }
+    fanout_presence(delta);
 }
 
-void chat_room::leave(chat_session_ptr session){
+void chat_room::subscribe_presence(const chat_session_ptr& session){
+    dense_registry<chat_session_ptr>& subscribers = shards_[session->shard()].subscribers_;
+    if (!subscribers.contains(session->presence_handle()))
+        session->set_presence_handle(subscribers.insert(session));
+}
+
+//handle要清掉：换到别的房间以后旧的{槽位,代数}可能正好等于那边别人的handle
+void chat_room::unsubscribe_presence(const chat_session_ptr& session){
+    shards_[session->shard()].subscribers_.erase(session->presence_handle());
+    session->set_presence_handle(session_handle());
+}
+
+std::vector<chat_frame_ptr> chat_room::presence_since(std::uint64_t since){
+    std::lock_guard<std::mutex> lock(mutex_);
+    return presence_since_locked(since);
+}
+
+chat_frame_ptr chat_room::presence_changed_locked(PPresenceDelta::Kind kind, std::uint64_t id, const std::string& name){
+    PPresence presence;
+    presence.set_version(++presence_version_);
+    PPresenceDelta* delta = presence.add_deltas();
+    delta->set_kind(kind);
+    delta->set_id(id);
+    delta->set_name(name);
+    chat_frame_ptr frame = make_frame(MT_PRESENCE, presence);
+    presence_log_.push(frame);
+    presence_pages_.reset();
+    return frame;
+}
+
+std::vector<chat_frame_ptr> chat_room::presence_since_locked(std::uint64_t since){
+    std::vector<chat_frame_ptr> frames;
+    //log里最旧的那一帧是这个版本
+    std::uint64_t oldest = presence_version_ - presence_log_.size() + 1;
+    if (since != 0 && since <= presence_version_ && since + 1 >= oldest) {
+        for (std::size_t i = since + 1 - oldest; i < presence_log_.size(); ++i)
+            frames.push_back(presence_log_[i]);
+        if (frames.empty()) {
+            //已经是最新的了，回一个没有变化的版本号
+            PPresence presence;
+            presence.set_version(presence_version_);
+            frames.push_back(make_frame(MT_PRESENCE, presence));
+        }
+        return frames;
+    }
+    if (!presence_pages_) {
+        //一页放到快满一帧为止(留32字节给version这些字段)，每个人占的大小自己算，不用每加一个都ByteSizeLong
+        auto pages = std::make_shared<std::vector<chat_frame_ptr>>();
+        PPresence page;
+        std::size_t page_size = 0;
+        auto flush = [&](bool last){
+            page.set_version(presence_version_);
+            page.set_snapshot(true);
+            page.set_page(static_cast<std::uint32_t>(pages->size()));
+            page.set_last(last);
+            pages->push_back(make_frame(MT_PRESENCE, page));
+            page.Clear();
+            page_size = 0;
+        };
+        for (const auto& member: members_) {
+            //按protobuf的编码算：id和name各一个tag，外面再一个tag和长度
+            using google::protobuf::io::CodedOutputStream;
+            std::size_t inner = 1 + CodedOutputStream::VarintSize64(member.first)
+                + 1 + CodedOutputStream::VarintSize32(member.second.size()) + member.second.size();
+            std::size_t size = 1 + CodedOutputStream::VarintSize32(inner) + inner;
+            if (page_size + size > chat_message::body_max_length - 32)
+                flush(false);
+            PPresenceMember* m = page.add_members();
+            m->set_id(member.first);
+            m->set_name(member.second);
+            page_size += size;
+        }
+        flush(true);
+        presence_pages_ = std::move(pages);
+    }
+    return *presence_pages_;
+}
+
+void chat_room::fanout_presence(const chat_frame_ptr& delta){
+    for_each_shard([this, delta](std::size_t i){
+            for (auto& session: shards_[i].subscribers_)
+                session->deliver_direct(delta);
+            });
+}
+
+//有日志的话交给它的都写进去了就行，下次建这个房间的时候历史消息从日志里读回来
+bool chat_room::disposable(){
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (log_)
+        return log_->settled();
+    return recent_msgs_.size() == 0;
+}
+
+std::shared_ptr<const std::string> chat_room::snapshot(std::size_t& frames, bool compact, bool deflate, bool flat){
+    std::lock_guard<std::mutex> lock(mutex_);
+    frames = recent_msgs_.size();
+    return backlog_locked(compact, deflate, flat);
+}
+
+const std::shared_ptr<const std::string>& chat_room::backlog_locked(bool compact, bool deflate, bool flat){
+    //没有就现拼一次，之后直到有新消息之前大家都用这一块
+    //几种格式各拼各的，没人用的那种就不拼
+    std::shared_ptr<const std::string>& backlog = backlogs_[compact + deflate * 2 + flat * 4];
+    std::size_t frames = recent_msgs_.size();
+    if (!backlog && frames > 0 && deflate) {
+        //压缩的是紧凑帧头的那一块，外面再按这个session的帧头切成MT_DEFLATED帧
+        backlog = deflate_block(*backlog_locked(true, false, flat), compact, deflate_level_);
+        if (!backlog)
+            return backlog_locked(compact, false, flat);
+    }
+    if (!backlog && frames > 0) {
+        //历史消息里的帧换成这种编码的样子，拼之前先挑好
+        std::vector<chat_frame_ptr> variants;
+        variants.reserve(frames);
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < frames; ++i) {
+            variants.push_back(frame_for_codec(recent_msgs_[i], flat, 0));
+            total += compact ? variants.back()->compact_length() : variants.back()->length();
+        }
+        auto block = std::make_shared<std::string>();
+        block->reserve(total);
+        for (std::size_t i = 0; i < frames; ++i) {
+            const chat_message& frame = *variants[i];
+            if (compact) {
+                block->append(reinterpret_cast<const char*>(frame.compact_header()), frame.compact_header_length());
+                block->append(frame.body(), frame.body_length());
+            } else {
+                block->append(frame.data(), frame.length());
+            }
+        }
+        backlog = std::move(block);
+    }
+    return backlog;
+}
+
+std::shared_ptr<const write_parts> chat_room::history(std::uint64_t before, std::size_t count,
+        bool compact, bool flat, std::size_t& frames){
+    count = std::min<std::size_t>(count, max_history_count);
+    //内存里有的在锁里拿出来，日志在锁外面读
+    std::vector<chat_frame_ptr> recent;
+    std::uint64_t first;
+    std::uint64_t end;
+    std::uint64_t ring_first;  //recent_msgs_里最旧的那一条的序号
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        end = before == 0 ? history_seq_ + 1 : std::min(before, history_seq_ + 1);
+        first = end > count ? end - count : 1;
+        ring_first = history_seq_ + 1 - recent_msgs_.size();
+        for (std::uint64_t seq = std::max(first, ring_first); seq < end; ++seq)
+            recent.push_back(recent_msgs_[seq - ring_first]);
+    }
+    std::uint64_t from = end - recent.size();  //从这一条开始是内存里的
+    std::uint64_t first_seq = from;
+    //有日志的话最旧的一条在日志里，内存里的都在窗口里的时候也要看日志，不然last会说已经翻到头了
+    std::uint64_t oldest = log_ ? std::min(log_->first_seq(), ring_first) : ring_first;
+    std::size_t records = 0;
+    //第一部分先空着，最后放MT_HISTORY帧；不用sendfile的话消息都拷进body，接在MT_HISTORY帧后面
+    auto parts = std::make_shared<write_parts>(1);
+    std::string body;
+    std::size_t bytes = 0;
+    if (log_ && first < from) {
+        std::uint64_t start = std::max(first, oldest);
+        std::vector<log_span> spans = log_->locate(start, from - start);
+        std::size_t logged = 0;
+        std::size_t logged_bytes = 0;
+        //session不要平铺格式的话日志里有平铺的就不能原样发
+        bool raw = true;
+        for (const log_span& span: spans) {
+            logged += span.records;
+            logged_bytes += span.length;
+            if (!flat && raw)
+                span.for_each([&raw](const Header& header, const char*, std::size_t){
+                        if (header.type == MT_ROOM_INFO_FLAT)
+                            raw = false;
+                        });
+        }
+        //日志线程还没写到的话接不上内存里的那一截，这次只给内存里的，下次再翻就有了
+        if (start + logged == from) {
+            first_seq = start;
+            records = logged;
+            if (raw && logged_bytes >= min_sendfile_bytes) {
+                for (log_span& span: spans) {
+                    parts->emplace_back();
+                    parts->back().span = std::move(span);
+                }
+                bytes += logged_bytes;
+            }else {
+                for (const log_span& span: spans)
+                    span.for_each([&body, flat](const Header& header, const char* data, std::size_t length){
+                            append_record(body, header, data, length, flat);
+                            });
+            }
+        }
+    }
+    //内存里的几条接在最后，前面是文件的话单独一部分
+    std::string tail;
+    for (const auto& msg: recent) {
+        const chat_message& frame = *frame_for_codec(msg, flat, 0);
+        tail.append(frame.data(), frame.length());
+    }
+    records += recent.size();
+    bytes += body.size() + tail.size();
+    if (parts->size() == 1) {
+        body.append(tail);
+    }else if (!tail.empty()) {
+        parts->emplace_back();
+        parts->back().bytes = std::move(tail);
+    }
+    PHistory reply;
+    reply.set_first_seq(records > 0 ? first_seq : 0);
+    reply.set_count(static_cast<std::uint32_t>(records));
+    reply.set_bytes(static_cast<std::uint32_t>(bytes));
+    reply.set_last(first_seq <= oldest);
+    chat_frame_ptr head = make_frame(MT_HISTORY, reply);
+    std::string& out = parts->front().bytes;
+    out.reserve(head->length() + body.size());
+    if (compact) {
+        out.append(reinterpret_cast<const char*>(head->compact_header()), head->compact_header_length());
+        out.append(head->body(), head->body_length());
+    } else {
+        out.append(head->data(), head->length());
+    }
+    out.append(body);
+    frames = records + 1;
+    return parts;
+}
+
+bool chat_room::leave(chat_session_ptr session){
     std::cout << "one client ";
     std::string name = session->getName();
     if(name.size() == 0)
@@ -230,49 +1827,170 @@ void chat_room::leave(chat_session_ptr session){
     else
         std::cout << name << " ";
     std::cout << "gone!" << std::endl;
-    sessions_.erase(session);
+    //读和写都出错的时候会leave两次，handle已经失效了就什么都不做
+    if (!shards_ || !shards_[session->shard()].sessions_.erase(session->room_handle()))
+        return false;
+    session->set_room_handle(session_handle());
+    unsubscribe_presence(session);
+    chat_frame_ptr delta;
+    bool empty;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        members_.erase(session->id());
+        empty = members_.empty();
+        delta = presence_changed_locked(PPresenceDelta::LEAVE, session->id(), std::string());
+    }
+    fanout_presence(delta);
+    //最后一个人走了，日志的段文件先关掉，房间很多的时候fd和映射只跟有人的房间数有关
+    if (empty && log_)
+        log_->release();
+    if (session->deflate())
+        deflate_sessions_.fetch_sub(1, std::memory_order_relaxed);
+    if (flat_ && !session->flat())
+        legacy_sessions_.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+void chat_room::deliver(const chat_frame_ptr& msg){
+    std::uint64_t seq;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        //把消息push到环形缓冲区里，满了就覆盖最旧的
+        recent_msgs_.push(msg);
+        for (auto& backlog: backlogs_)
+            backlog.reset();
+        ++history_seq_;
+        //只是放进日志线程的队列，不等写盘
+        if (log_)
+            log_->append(msg);
+        seq = ++last_seq_;
+    }
+    fanout(msg, seq);
+}
+
+void chat_room::relay(const chat_frame_ptr& msg){
+    std::uint64_t seq;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        seq = ++last_seq_;
+    }
+    fanout(msg, seq);
+}
+
+void chat_room::fanout(const chat_frame_ptr& msg, std::uint64_t seq){
+    //每个分片只投递一次，由分片自己的strand去发给它的session
+    //当前就在这个分片的strand里的话直接发，省一次post
+    //发消息的人在房间里，shards_已经分配好了
+    for_each_shard([this, msg, seq](std::size_t i){ deliver_shard(i, msg, seq); });
 }
 
-void chat_room::deliver(const chat_message& msg){
-    //把消息push到接受队列最后
-    recent_msgs_.push_back(msg);
-    //消息超过一定长度就扔掉
-    while (recent_msgs_.size() > max_recent_msgs)
-        recent_msgs_.pop_front();
+void chat_room::deliver_shard(std::size_t index, const chat_frame_ptr& msg, std::uint64_t seq){
     //智能指针拷贝是普通指针拷贝的10倍
     //调用chat_sesstion的deliver
-    for (auto& session: sessions_)
-        session->deliver(msg);
+    for (auto& session: shards_[index].sessions_) {
+        //join的时候已经在历史消息里面补发过了
+        if (seq > session->joined_seq())
+            session->deliver(msg);
+    }
 }
 
 //----------------------------------------------------------------------
 
+//SO_REUSEPORT：多个socket可以bind同一个端口，由内核把新连接分给它们
+using reuse_port = boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+
 class chat_server{
     public:
+        //reuseport为false时只有一个acceptor，新连接再分给各个分片
+        //为true时每个分片一个SO_REUSEPORT的acceptor，accept直接在分片自己的线程上做，
+        //不用在一个acceptor上排队；所有acceptor背后还是同一组房间
         chat_server(boost::asio::io_context& io_context,
-                const tcp::endpoint& endpoint)
-            : acceptor_(io_context, endpoint){
-                do_accept();
+                io_context_pool& pool,
+                const tcp::endpoint& endpoint,
+                bool reuseport,
+                std::size_t history,
+                int deflate_level,
+                bool flat,
+                message_log* log,
+                const session_limits& limits)
+            : pool_(pool),
+            limits_(limits),
+            //每个端口一组房间，日志也按端口分开
+            rooms_(pool, history, deflate_level, flat, log, std::to_string(endpoint.port())){
+                if (!reuseport) {
+                    acceptors_.emplace_back(new tcp::acceptor(io_context, endpoint));
+                    do_accept(0);
+                    return;
+                }
+                for (std::size_t shard = 0; shard < pool.size(); ++shard) {
+                    //acceptor建在分片的strand上，accept的回调也就在这个分片上
+                    std::unique_ptr<tcp::acceptor> acceptor(new tcp::acceptor(pool.get_executor(shard)));
+                    acceptor->open(endpoint.protocol());
+                    acceptor->set_option(tcp::acceptor::reuse_address(true));
+                    acceptor->set_option(reuse_port(true));
+                    acceptor->bind(endpoint);
+                    acceptor->listen();
+                    acceptors_.push_back(std::move(acceptor));
+                    do_accept(shard);
+                }
             }
 
     private:
-        void do_accept(){
+        void do_accept(std::size_t index){
+            //先选好新连接要放到哪个分片上，socket直接建在那个分片的strand上
+            //这样socket的回调默认就都在这个strand上执行
+            //每个分片都有自己acceptor的时候就放在acceptor所在的分片上
+            std::size_t shard = acceptors_.size() > 1 ? pool_.acquire(index) : pool_.acquire();
             //这里异步连接一个新的客户端
-            acceptor_.async_accept(
-                    [this](boost::system::error_code ec, tcp::socket socket){
+            acceptors_[index]->async_accept(pool_.get_executor(shard),
+                    [this, index, shard](boost::system::error_code ec, tcp::socket socket){
                     if (!ec){
-                        auto session = std::make_shared<chat_session>(std::move(socket), room_);
-                        session->start();
+                        auto session = std::make_shared<chat_session>(std::move(socket), rooms_, names_, pool_, shard, limits_);
+                        //start要在session自己的strand上跑，已经在的话就直接跑
+                        boost::asio::dispatch(pool_.get_executor(shard),
+                                [session](){ session->start(); });
+                    }else {
+                        pool_.release(shard);
                     }
                         //这里可能会有错误，但是服务器端的工作不能停
                         //比如三次握手失败了，失败的逻辑在客户端那边处理，服务器不管，继续监听
-                        do_accept();
+                        do_accept(index);
                     });
         }
 
+        io_context_pool& pool_;
+        const session_limits& limits_;
         //acceptor就是那个监听器
-        tcp::acceptor acceptor_;
-        chat_room room_; //这里为什么不用引用？因为可能绑定多个端口有多个room
+        std::vector<std::unique_ptr<tcp::acceptor>> acceptors_;
+        //这里为什么不用引用？因为可能绑定多个端口，每个端口有自己的一组房间
+        room_registry rooms_;
+        name_directory names_;
+};
+
+//----------------------------------------------------------------------
+
+//每隔几秒把g_stats打出来
+class stats_printer{
+    public:
+        stats_printer(boost::asio::io_context& io_context, int seconds)
+            : timer_(io_context),
+            interval_(seconds){
+                wait();
+            }
+
+    private:
+        void wait(){
+            timer_.expires_after(std::chrono::seconds(interval_));
+            timer_.async_wait([this](boost::system::error_code ec){
+                        if (!ec){
+                            g_stats.print(std::cout);
+                            wait();
+                        }
+                    });
+        }
+
+        boost::asio::steady_timer timer_;
+        int interval_;
 };
 
 //----------------------------------------------------------------------
@@ -282,22 +2000,115 @@ int main(int argc, char* argv[]) {
         //这个宏是为了判断是否兼容proto的前面的版本
         //因为是动态链接，可能分布到机器上会有问题
         GOOGLE_PROTOBUF_VERIFY_VERSION;
-        if (argc < 2) {
-            //每一个chat server就是一个room，这里可以绑定多个端口
-            std::cerr << "Usage: chat_server <port> [<port> ...]\n";
+        //-t 线程数(分片个数)，0表示每个核一个，默认1就是原来的单线程
+        //-b 新连接的分配方式，rr轮询或者load按负载
+        //-m pool每个线程一个io_context，strand所有线程跑同一个io_context
+        //-r 每个线程开一个SO_REUSEPORT的acceptor，让内核去分配新连接
+        //-s 每隔几秒打印一次统计计数，0不打印
+        //-H 每个room保留多少条历史消息
+        //-q/-Q 每个session发送队列最多多少帧/多少字节，0不限制
+        //-p 队列满了以后怎么办：drop-oldest drop-newest snapshot disconnect
+        //-z 压缩级别1~9，0表示不答应客户端压缩
+        //-c 聊天消息的编码：protobuf，或者flat平铺格式(老客户端收到的还是protobuf)
+        //-L 消息落盘的目录，不给就不落盘
+        //-S 日志每个段文件多大(字节)
+        //-F 日志最多隔多少毫秒刷一次盘，0表示每写一批就刷
+        std::size_t threads = 1;
+        std::size_t history = 100;
+        session_limits limits;
+        bool reuseport = false;
+        int deflate_level = 6;
+        bool flat = false;
+        int stats_interval = 0;
+        std::string log_directory;
+        std::size_t segment_size = 16 * 1024 * 1024;
+        int commit_ms = 10;
+        io_context_pool::balance_policy policy = io_context_pool::round_robin;
+        io_context_pool::run_mode mode = io_context_pool::one_context_per_thread;
+        int opt;
+        while ((opt = getopt(argc, argv, "t:b:m:rs:H:q:Q:p:z:c:L:S:F:")) != -1) {
+            if (opt == 't') {
+                threads = std::strtoul(optarg, nullptr, 10);
+                if (threads == 0)
+                    threads = std::max(1u, std::thread::hardware_concurrency());
+            }else if (opt == 'b' && std::string(optarg) == "load") {
+                policy = io_context_pool::least_load;
+            }else if (opt == 'b' && std::string(optarg) == "rr") {
+                policy = io_context_pool::round_robin;
+            }else if (opt == 'm' && std::string(optarg) == "pool") {
+                mode = io_context_pool::one_context_per_thread;
+            }else if (opt == 'm' && std::string(optarg) == "strand") {
+                mode = io_context_pool::shared_context;
+            }else if (opt == 'r') {
+                reuseport = true;
+            }else if (opt == 's') {
+                stats_interval = std::atoi(optarg);
+            }else if (opt == 'H') {
+                history = std::strtoul(optarg, nullptr, 10);
+            }else if (opt == 'q') {
+                limits.max_frames = std::strtoul(optarg, nullptr, 10);
+            }else if (opt == 'Q') {
+                limits.max_bytes = std::strtoul(optarg, nullptr, 10);
+            }else if (opt == 'p' && std::string(optarg) == "drop-oldest") {
+                limits.policy = session_limits::drop_oldest;
+            }else if (opt == 'p' && std::string(optarg) == "drop-newest") {
+                limits.policy = session_limits::drop_newest;
+            }else if (opt == 'p' && std::string(optarg) == "snapshot") {
+                limits.policy = session_limits::snapshot;
+            }else if (opt == 'p' && std::string(optarg) == "disconnect") {
+                limits.policy = session_limits::disconnect;
+            }else if (opt == 'z') {
+                deflate_level = std::min(std::max(std::atoi(optarg), 0), 9);
+            }else if (opt == 'c' && std::string(optarg) == "protobuf") {
+                flat = false;
+            }else if (opt == 'c' && std::string(optarg) == "flat") {
+                flat = true;
+            }else if (opt == 'L') {
+                log_directory = optarg;
+            }else if (opt == 'S') {
+                segment_size = std::strtoul(optarg, nullptr, 10);
+            }else if (opt == 'F') {
+                commit_ms = std::max(std::atoi(optarg), 0);
+            }else {
+                optind = argc;  //参数不对，走下面的Usage
+                break;
+            }
+        }
+        if (optind >= argc) {
+            //每一个chat server是一组房间(连上来先在大厅)，这里可以绑定多个端口
+            std::cerr << "Usage: chat_server [-t threads] [-b rr|load] [-m pool|strand] [-r] [-s seconds] [-H history]\n"
+                "                   [-q frames] [-Q bytes] [-p drop-oldest|drop-newest|snapshot|disconnect] [-z level]\n"
+                "                   [-c protobuf|flat] [-L log-directory] [-S segment-bytes] [-F commit-ms]\n"
+                "                   <port> [<port> ...]\n";
             return 1;
         }
 
-        boost::asio::io_context io_context;
+        //日志要比pool和server活得久，退出的时候队列里剩下的写完刷完
+        //攒到1M也刷一次，消息多的时候不用等到-F的时间
+        std::unique_ptr<message_log> log;
+        if (!log_directory.empty())
+            log.reset(new message_log(log_directory, segment_size, 1024 * 1024, std::chrono::milliseconds(commit_ms)));
+
+        io_context_pool pool(threads, policy, mode);
 
         std::list<chat_server> servers;
-        for (int i = 1; i < argc; ++i) {
+        for (int i = optind; i < argc; ++i) {
              //这里就是在绑定端口，进行监听
             tcp::endpoint endpoint(tcp::v4(), std::atoi(argv[i]));
-            servers.emplace_back(io_context, endpoint);
+            //多个端口的acceptor也轮流放到不同的io_context上（strand模式下都在同一个上）
+            servers.emplace_back(pool.get_io_context((i - optind) % pool.size()), pool, endpoint, reuseport, history, deflate_level, flat, log.get(), limits);
         }
+
+        //ctrl+c的时候让所有io_context退出，正常析构
+        boost::asio::signal_set signals(pool.get_io_context(0), SIGINT, SIGTERM);
+        signals.async_wait([&pool](boost::system::error_code, int){ pool.stop(); });
+
+        std::unique_ptr<stats_printer> printer;
+        if (stats_interval > 0)
+            printer.reset(new stats_printer(pool.get_io_context(0), stats_interval));
+
         //这里是异步的，只要server还有服务就不会退出
-        io_context.run();
+        pool.run();
     }
     catch (std::exception& e) {
         std::cerr << "Exception: " << e.what() << "\n";